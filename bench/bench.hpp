@@ -0,0 +1,45 @@
+#ifndef BENCH_HPP
+#define BENCH_HPP
+/*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Timing helpers for the runtime benchmarks in bench/
+*/
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <vector>
+
+// keep(v): store v to a volatile sink so its computation isn't elided
+template <typename T>
+void keep(T v)
+{
+  static T volatile sink;
+  sink = v;
+  static_cast<void>(sink);
+}
+
+// bench(name,ops,f): time samples of f(), which does ops operations,
+//                    and print mean ns/op, standard deviation and min
+template <typename F>
+void bench(char const* name, double ops, F f, int samples = 21)
+{
+  using clock = std::chrono::steady_clock;
+  f(); // warm up
+  std::vector<double> ns(samples);
+  for (double& t : ns) {
+    auto t0 = clock::now();
+    f();
+    auto t1 = clock::now();
+    t = std::chrono::duration<double,std::nano>(t1 - t0).count() / ops;
+  }
+  double mean = 0, var = 0, min = ns[0];
+  for (double t : ns) { mean += t; min = t < min ? t : min; }
+  mean /= samples;
+  for (double t : ns) var += (t - mean) * (t - mean);
+  std::printf("%-32s %9.3f ns/op  +-%7.3f  min %9.3f\n",
+              name, mean, std::sqrt(var / samples), min);
+}
+
+#endif
@@ -0,0 +1,183 @@
+#include "IREPEAT.hpp"
+#include "CCLASS.hpp"
+#include "bench.hpp"
+
+#include <cctype>
+#include <random>
+#include <string>
+
+/*
+   Runtime benchmark of CCLASS.hpp bit-packed character classes
+   against a separate bool table per class and <cctype> functions.
+
+   The input is 64K of C-like source, random identifiers, numbers,
+   punctuation and whitespace. Each method classifies every byte by
+   four classes, counting each, then lexes the input into tokens,
+   skipping whitespace, counting identifiers, numbers and punctuators,
+   with the tables in L1 cache, and again in 256 byte lines, each
+   after evicting L1 cache by writing 64K, as a lexer called on short
+   input between other work. Reports ns/byte.
+ */
+
+#define LEX(H) CAT(LEX_,SEQCAT(H))
+#define LEX_0 (space,CCLASS_SPACE)
+#define LEX_1 (digit,CCLASS_DIGIT)
+#define LEX_2 (punct,CCLASS_PUNCT)
+#define LEX_3 (idstart,CCLASS_IDSTART)
+#define LEX_4 (idcont,CCLASS_IDCONT)
+
+CCLASS(lex,(5),LEX)
+
+// packed: one table entry per byte, masked per class
+struct packed {
+  static bool space(char c) { return lex::is(c, lex::space); }
+  static bool digit(char c) { return lex::is(c, lex::digit); }
+  static bool punct(char c) { return lex::is(c, lex::punct); }
+  static bool idstart(char c) { return lex::is(c, lex::idstart); }
+  static bool idcont(char c) { return lex::is(c, lex::idcont); }
+};
+
+// separate: a 256 entry bool table per class
+#define TABLE(NAME,AT) bool const NAME##_t[256] {IREPEAT((f)(f),AT,COMMA)};
+#define SPACE_AT(H) CCLASS_SPACE(HEXLIT(H))
+#define DIGIT_AT(H) CCLASS_DIGIT(HEXLIT(H))
+#define PUNCT_AT(H) CCLASS_PUNCT(HEXLIT(H))
+#define IDSTART_AT(H) CCLASS_IDSTART(HEXLIT(H))
+#define IDCONT_AT(H) CCLASS_IDCONT(HEXLIT(H))
+TABLE(space,SPACE_AT)
+TABLE(digit,DIGIT_AT)
+TABLE(punct,PUNCT_AT)
+TABLE(idstart,IDSTART_AT)
+TABLE(idcont,IDCONT_AT)
+
+struct separate {
+  static unsigned char u(char c) { return static_cast<unsigned char>(c); }
+  static bool space(char c) { return space_t[u(c)]; }
+  static bool digit(char c) { return digit_t[u(c)]; }
+  static bool punct(char c) { return punct_t[u(c)]; }
+  static bool idstart(char c) { return idstart_t[u(c)]; }
+  static bool idcont(char c) { return idcont_t[u(c)]; }
+};
+
+// cctype: the standard functions, "C" locale
+struct cctype {
+  static int u(char c) { return static_cast<unsigned char>(c); }
+  static bool space(char c) { return std::isspace(u(c)); }
+  static bool digit(char c) { return std::isdigit(u(c)); }
+  static bool punct(char c) { return std::ispunct(u(c)); }
+  static bool idstart(char c) { return std::isalpha(u(c)) || c == '_'; }
+  static bool idcont(char c) { return std::isalnum(u(c)) || c == '_'; }
+};
+
+// classify<C>(s): count bytes of each of four classes
+template <typename C>
+unsigned classify(std::string const& s)
+{
+  unsigned sp = 0, di = 0, pu = 0, id = 0;
+  for (char c : s) {
+    sp += C::space(c);
+    di += C::digit(c);
+    pu += C::punct(c);
+    id += C::idcont(c);
+  }
+  return sp + di * 3 + pu * 5 + id * 7;
+}
+
+// lex<C>(p,e): count identifiers, numbers and punctuators in [p,e)
+template <typename C>
+unsigned lex(char const* p, char const* e)
+{
+  unsigned ids = 0, nums = 0, puncts = 0;
+  while (p != e) {
+    if (C::space(*p))
+      ++p;
+    else if (C::idstart(*p)) {
+      while (++p != e && C::idcont(*p)) {}
+      ++ids;
+    } else if (C::digit(*p)) {
+      while (++p != e && C::idcont(*p)) {}
+      ++nums;
+    } else
+      ++p, ++puncts;
+  }
+  return ids + nums * 3 + puncts * 5;
+}
+
+// source(rng): 64K of random identifiers, numbers, punctuators, spaces
+std::string source(std::mt19937& rng)
+{
+  char const* id = "abcdefghijklmnopqrstuvwxyz"
+                   "ABCDEFGHIJKLMNOPQRSTUVWXYZ_0123456789";
+  char const* punct = "(){}[];,.+-*/=<>!&|";
+  char const* space = "    \n\t";
+  std::string s;
+  while (s.size() < 0x10000) {
+    switch (rng() % 4) {
+      case 0: case 1:
+        s += id[rng() % 53];
+        for (unsigned n = rng() % 12; n != 0; --n) s += id[rng() % 63];
+        break;
+      case 2:
+        s += id[53 + rng() % 10];
+        for (unsigned n = rng() % 4; n != 0; --n) s += id[53 + rng() % 10];
+        break;
+      case 3:
+        s += punct[rng() % 19];
+        break;
+    }
+    s += space[rng() % 6];
+  }
+  s.resize(0x10000);
+  return s;
+}
+
+// lex_cold<C>(s,evict): lex s in 256 byte lines, each after writing
+//                       a line of evict, 64K, so tables start cold
+template <typename C>
+unsigned lex_cold(std::string const& s, std::vector<char>& evict)
+{
+  unsigned n = 0;
+  for (std::size_t i = 0; i != s.size(); i += 256) {
+    for (std::size_t j = 0; j < evict.size(); j += 64)
+      ++evict[j];
+    n += lex<C>(s.data() + i, s.data() + i + 256);
+  }
+  return n;
+}
+
+template <typename C>
+void run(char const* name, std::string const& s, std::vector<char>& evict)
+{
+  std::printf("%s\n", name);
+  bench("  classify", double(s.size()), [&s] { keep(classify<C>(s)); });
+  bench("  lex", double(s.size()),
+        [&s] { keep(lex<C>(s.data(), s.data() + s.size())); });
+  bench("  lex 256 byte lines, cold", double(s.size()),
+        [&s,&evict] { keep(lex_cold<C>(s, evict)); });
+}
+
+int main()
+{
+  std::mt19937 rng(42);
+  std::string const s = source(rng);
+  std::vector<char> evict(0x10000);
+
+  if (classify<packed>(s) != classify<separate>(s)
+   || classify<packed>(s) != classify<cctype>(s)
+   || lex_cold<packed>(s, evict) != lex_cold<separate>(s, evict)
+   || lex_cold<packed>(s, evict) != lex_cold<cctype>(s, evict))
+    std::printf("methods differ\n");
+
+  run<packed>("CCLASS, one table", s, evict);
+  run<separate>("separate bool tables", s, evict);
+  run<cctype>("<cctype>", s, evict);
+}
+
+#undef TABLE
+#undef SPACE_AT
+#undef DIGIT_AT
+#undef PUNCT_AT
+#undef IDSTART_AT
+#undef IDCONT_AT
+
+#include "IREPEAT_UNDEF.hpp"
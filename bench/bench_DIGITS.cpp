@@ -0,0 +1,118 @@
+#include "IREPEAT.hpp"
+#include "DIGITS.hpp"
+#include "bench.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+
+#if __cplusplus >= 201703L || _MSVC_LANG >= 201703L
+#include <charconv>
+#define HAS_CHARCONV 1
+#endif
+
+/*
+   Runtime benchmark of DIGITS.hpp integer formatting and parsing
+   against std::to_chars and std::from_chars, where available.
+
+   Values are random with a uniform spread of bit lengths, as from
+   counters, sizes and ids, rather than uniform values, nearly all of
+   full length. Each method formats, or parses, 4096 values of
+   std::uint32_t or std::uint64_t, in decimal and in hex, to and from
+   a buffer of strings, each in 24 chars. Reports ns/value.
+ */
+
+DIGITS(digits)
+
+constexpr unsigned N = 4096;
+
+// values<U>(rng): N values, each shifted right by a random bit count
+template <typename U>
+std::vector<U> values(std::mt19937_64& rng)
+{
+  std::vector<U> v(N);
+  for (U& x : v)
+    x = static_cast<U>(rng()) >> rng() % (8 * sizeof(U));
+  return v;
+}
+
+// format<U>(name,v,to): time to(p,v) of each value into buf
+template <typename U, typename F>
+void format(char const* name, std::vector<U> const& v, char* buf, F to)
+{
+  bench(name, N, [&v,buf,to] {
+    for (unsigned i = 0; i != N; ++i)
+      *to(buf + 24 * i, v[i]) = 0;
+    keep(buf[24 * (N - 1)]);
+  });
+}
+
+// parse<U>(name,buf,from): time from(first,last,v) of each string of buf
+template <typename U, typename F>
+void parse(char const* name, char const* buf, F from)
+{
+  std::vector<unsigned char> len(N);
+  for (unsigned i = 0; i != N; ++i)
+    len[i] = static_cast<unsigned char>(std::strlen(buf + 24 * i));
+  bench(name, N, [buf,from,&len] {
+    U sum = 0;
+    for (unsigned i = 0; i != N; ++i) {
+      U x = 0;
+      from(buf + 24 * i, buf + 24 * i + len[i], x);
+      sum += x;
+    }
+    keep(sum);
+  });
+}
+
+template <typename U>
+void run(char const* bits, std::mt19937_64& rng)
+{
+  std::vector<U> v = values<U>(rng);
+  std::vector<char> buf(24 * N);
+  std::printf("std::uint%s_t:\n", bits);
+
+  format("DIGITS to_dec", v, buf.data(),
+         [](char* p, U x) { return digits::to_dec(p, x); });
+#if HAS_CHARCONV
+  format("std::to_chars", v, buf.data(),
+         [](char* p, U x) { return std::to_chars(p, p + 24, x).ptr; });
+#endif
+  parse<U>("DIGITS from_dec", buf.data(),
+           [](char const* f, char const* l, U& x) {
+             digits::from_dec(f, l, x); });
+#if HAS_CHARCONV
+  parse<U>("std::from_chars", buf.data(),
+           [](char const* f, char const* l, U& x) {
+             std::from_chars(f, l, x); });
+#endif
+
+  format("DIGITS to_hex", v, buf.data(),
+         [](char* p, U x) { return digits::to_hex(p, x); });
+#if HAS_CHARCONV
+  format("std::to_chars base 16", v, buf.data(),
+         [](char* p, U x) { return std::to_chars(p, p + 24, x, 16).ptr; });
+#endif
+  parse<U>("DIGITS from_hex", buf.data(),
+           [](char const* f, char const* l, U& x) {
+             digits::from_hex(f, l, x); });
+#if HAS_CHARCONV
+  parse<U>("std::from_chars base 16", buf.data(),
+           [](char const* f, char const* l, U& x) {
+             std::from_chars(f, l, x, 16); });
+#endif
+}
+
+int main()
+{
+#if !HAS_CHARCONV
+  std::printf("std::to_chars not available, C++17\n");
+#endif
+  std::mt19937_64 rng(42);
+  run<std::uint32_t>("32", rng);
+  run<std::uint64_t>("64", rng);
+}
+
+#undef HAS_CHARCONV
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,98 @@
+#include "IREPEAT.hpp"
+#include "DISPATCH.hpp"
+#include "bench.hpp"
+
+#include <random>
+#include <utility>
+
+/*
+   Runtime benchmark of DISPATCH.hpp switch and table dispatch against
+   std::index_sequence pack expansions, for 16 and 256 kernels.
+
+   Each method calls kernel<n>(x) for random n; the index_sequence
+   methods are a pointer table built by pack expansion (C++14) and
+   a fold over || of n == I comparisons (C++17).
+ */
+
+template <unsigned K>
+unsigned kernel(unsigned x) { return (x ^ K) * (2 * K + 1); }
+
+DISPATCH(dispatch16,(1)(0),kernel)
+DISPATCH(dispatch256,(1)(0)(0),kernel)
+
+unsigned call16(unsigned n, unsigned x) { return dispatch16::call(n,x); }
+unsigned call256(unsigned n, unsigned x) { return dispatch256::call(n,x); }
+unsigned jump16(unsigned n, unsigned x) { return dispatch16::jump(n,x); }
+unsigned jump256(unsigned n, unsigned x) { return dispatch256::jump(n,x); }
+
+#if __cplusplus >= 201402L
+template <unsigned... I>
+unsigned seq_table(std::integer_sequence<unsigned,I...>, unsigned n, unsigned x)
+{
+  static constexpr unsigned (*table[])(unsigned) {&kernel<I>...};
+  return table[n](x);
+}
+
+template <unsigned N>
+unsigned seq_table(unsigned n, unsigned x)
+{
+  return seq_table(std::make_integer_sequence<unsigned,N>{}, n, x);
+}
+#endif
+
+#if __cpp_fold_expressions
+template <unsigned... I>
+unsigned seq_fold(std::integer_sequence<unsigned,I...>, unsigned n, unsigned x)
+{
+  unsigned r = 0;
+  static_cast<void>(((n == I && (r = kernel<I>(x), true)) || ...));
+  return r;
+}
+
+template <unsigned N>
+unsigned seq_fold(unsigned n, unsigned x)
+{
+  return seq_fold(std::make_integer_sequence<unsigned,N>{}, n, x);
+}
+#endif
+
+int main()
+{
+  constexpr unsigned calls = 1 << 16;
+  std::mt19937 rng(42);
+
+  for (unsigned n : {16u, 256u}) {
+    std::vector<unsigned> ns(calls);
+    for (auto& k : ns) k = rng() % n;
+
+    auto run = [&ns](unsigned (*dispatch)(unsigned, unsigned)) {
+      return [&ns,dispatch] {
+        unsigned sum = 0;
+        for (unsigned k : ns) sum += dispatch(k, sum);
+        keep(sum);
+      };
+    };
+    std::printf("%u kernels, random index:\n", n);
+    if (n == 16) {
+      bench("DISPATCH call", calls, run(call16));
+      bench("DISPATCH jump", calls, run(jump16));
+#if __cplusplus >= 201402L
+      bench("index_sequence table", calls, run(seq_table<16>));
+#endif
+#if __cpp_fold_expressions
+      bench("index_sequence fold", calls, run(seq_fold<16>));
+#endif
+    } else {
+      bench("DISPATCH call", calls, run(call256));
+      bench("DISPATCH jump", calls, run(jump256));
+#if __cplusplus >= 201402L
+      bench("index_sequence table", calls, run(seq_table<256>));
+#endif
+#if __cpp_fold_expressions
+      bench("index_sequence fold", calls, run(seq_fold<256>));
+#endif
+    }
+  }
+}
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,135 @@
+#include "IREPEAT.hpp"
+#include "DUFF.hpp"
+#include "bench.hpp"
+
+#include <cstdint>
+#include <random>
+
+/*
+   Runtime benchmark of DUFF.hpp Duff's device against a plain loop
+   and a compiler unroll pragma, for short runtime trip counts [0,64)
+   so that the remainder entry matters as much as the main loop.
+
+   Two bodies: a serial FNV-1a hash step, latency bound, and
+   a byte translation through a 256 entry table, throughput bound.
+ */
+
+#if defined(__clang__)
+#  define PRAGMA_UNROLL _Pragma("unroll 16")
+#elif defined(__GNUC__)
+#  define PRAGMA_UNROLL _Pragma("GCC unroll 16")
+#else
+#  define PRAGMA_UNROLL
+#endif
+
+constexpr std::uint64_t fnv_prime = 0x100000001b3;
+
+#define STEP() h = (h ^ *p++) * fnv_prime;
+
+std::uint64_t hash_loop(unsigned char const* p, unsigned n, std::uint64_t h)
+{
+  for (unsigned i = 0; i != n; ++i)
+    STEP()
+  return h;
+}
+
+std::uint64_t hash_pragma(unsigned char const* p, unsigned n, std::uint64_t h)
+{
+  PRAGMA_UNROLL
+  for (unsigned i = 0; i != n; ++i)
+    STEP()
+  return h;
+}
+
+std::uint64_t hash_duff16(unsigned char const* p, unsigned n, std::uint64_t h)
+{
+  DUFF((1)(0),n,STEP);
+  return h;
+}
+
+std::uint64_t hash_duff32(unsigned char const* p, unsigned n, std::uint64_t h)
+{
+  DUFF((2)(0),n,STEP);
+  return h;
+}
+
+#define XLAT() *d++ = table[*s++];
+
+void xlat_loop(unsigned char* d, unsigned char const* s, unsigned n,
+               unsigned char const* table)
+{
+  for (unsigned i = 0; i != n; ++i)
+    XLAT()
+}
+
+void xlat_pragma(unsigned char* d, unsigned char const* s, unsigned n,
+                 unsigned char const* table)
+{
+  PRAGMA_UNROLL
+  for (unsigned i = 0; i != n; ++i)
+    XLAT()
+}
+
+void xlat_duff16(unsigned char* d, unsigned char const* s, unsigned n,
+                 unsigned char const* table)
+{
+  DUFF((1)(0),n,XLAT);
+}
+
+void xlat_duff32(unsigned char* d, unsigned char const* s, unsigned n,
+                 unsigned char const* table)
+{
+  DUFF((2)(0),n,XLAT);
+}
+
+int main()
+{
+  constexpr unsigned runs = 1 << 16;
+  std::vector<unsigned char> data(runs + 64);
+  std::vector<unsigned> lens(runs);
+  std::mt19937 rng(42);
+  for (auto& c : data) c = static_cast<unsigned char>(rng());
+  double bytes = 0;
+  for (auto& n : lens) bytes += n = rng() % 64;
+
+  auto run = [&](std::uint64_t (*hash)(unsigned char const*,unsigned,
+                                       std::uint64_t)) {
+    return [&,hash] {
+      std::uint64_t h = 0xcbf29ce484222325;
+      for (unsigned i = 0; i != runs; ++i)
+        h = hash(data.data() + i, lens[i], h);
+      keep(h);
+    };
+  };
+
+  std::printf("FNV-1a over %u runs of 0-63 bytes, per byte:\n", runs);
+  bench("plain loop", bytes, run(hash_loop));
+  bench("unroll 16 pragma", bytes, run(hash_pragma));
+  bench("DUFF((1)(0)) 16-way", bytes, run(hash_duff16));
+  bench("DUFF((2)(0)) 32-way", bytes, run(hash_duff32));
+
+  unsigned char table[256];
+  for (unsigned i = 0; i != 256; ++i) table[i] = static_cast<unsigned char>(~i);
+  std::vector<unsigned char> out(runs + 64);
+
+  auto xrun = [&](void (*xlat)(unsigned char*,unsigned char const*,unsigned,
+                               unsigned char const*)) {
+    return [&,xlat] {
+      for (unsigned i = 0; i != runs; ++i)
+        xlat(out.data() + (i & 63), data.data() + i, lens[i], table);
+      keep(out[runs & 63]);
+    };
+  };
+
+  std::printf("Table translate over %u runs of 0-63 bytes, per byte:\n", runs);
+  bench("plain loop", bytes, xrun(xlat_loop));
+  bench("unroll 16 pragma", bytes, xrun(xlat_pragma));
+  bench("DUFF((1)(0)) 16-way", bytes, xrun(xlat_duff16));
+  bench("DUFF((2)(0)) 32-way", bytes, xrun(xlat_duff32));
+}
+
+#undef PRAGMA_UNROLL
+#undef STEP
+#undef XLAT
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,204 @@
+#include "IREPEAT.hpp"
+#include "bench.hpp"
+
+#include <functional>
+#include <random>
+
+/*
+   Runtime benchmark of plain IREPEAT-generated code against idiomatic
+   C++ equivalents: unrolled loops, a 256-way switch dispatch,
+   a generated lookup table and flat struct initialization.
+
+   Unrolled loops: FNV-1a hash of 32-byte keys, a serial dependency,
+                   and a dot product of 16 ints, independent products.
+   Dispatch: 256 distinct operations on x selected by a byte k,
+             as a generated switch, a table of pointers to template
+             instantiations op<k>, or a table of std::function of
+             one lambda capturing k, a single predicted call target.
+   Lookup: byte bit reversal by a generated constexpr table, a table
+           filled at startup, or computed bit by bit.
+   Struct init: a struct of 64 named members by aggregate initializer
+                against a struct of an array filled by a loop.
+ */
+
+#define FNV(H) fnv_h = (fnv_h ^ p[HEXLIT(H)]) * 16777619u;
+#define DOT(H) a[HEXLIT(H)] * b[HEXLIT(H)]
+
+inline unsigned fnv_unrolled(unsigned char const* p)
+{
+  unsigned fnv_h = 2166136261u;
+  XREPEAT((2)(0),FNV,NOSEP)
+  return fnv_h;
+}
+
+inline unsigned fnv_loop(unsigned char const* p)
+{
+  unsigned fnv_h = 2166136261u;
+  for (unsigned i = 0; i != 32; ++i)
+    fnv_h = (fnv_h ^ p[i]) * 16777619u;
+  return fnv_h;
+}
+
+inline int dot_unrolled(int const* a, int const* b)
+{
+  return XREPEAT((1)(0),DOT,+ EAT);
+}
+
+inline int dot_loop(int const* a, int const* b)
+{
+  int s = 0;
+  for (unsigned i = 0; i != 16; ++i)
+    s += a[i] * b[i];
+  return s;
+}
+
+// op k: rotate x left by k%31+1 then xor a k-dependent constant
+#define ROTX(K,x) ((x) << ((K)%31+1) | (x) >> (31-(K)%31)) ^ (K)*0x9e3779b9u
+#define OP_CASE(H) case HEXLIT(H): return ROTX(HEXLIT(H),x);
+
+unsigned op_switch(unsigned k, unsigned x)
+{
+  switch (k) { XREPEAT((1)(0)(0),OP_CASE,NOSEP) }
+  return x;
+}
+
+template <unsigned K> unsigned op(unsigned x) { return ROTX(K,x); }
+
+// fill<K>(t): t[k] = &op<k> for k < K, by recursion, C++11
+template <unsigned K>
+void fill(unsigned (**t)(unsigned)) { t[K-1] = op<K-1>; fill<K-1>(t); }
+template <>
+void fill<0>(unsigned (**)(unsigned)) {}
+
+// Reverse the bits of byte b by a 64-bit multiply, modulus trick
+#define REV(H) (HEXLIT(H) * 0x0202020202ull & 0x010884422010ull) % 1023
+
+constexpr unsigned char rev_table[] {XREPEAT((1)(0)(0),REV,COMMA)};
+
+inline unsigned char rev_bits(unsigned char b)
+{
+  unsigned char r = 0;
+  for (unsigned i = 0; i != 8; ++i)
+    r = static_cast<unsigned char>(r << 1 | (b >> i & 1));
+  return r;
+}
+
+#define MEMBER(H) unsigned x0D(H);
+#define INIT(H) v + HEXLIT(H) * HEXLIT(H)
+
+struct flat { XREPEAT((4)(0),MEMBER,NOSEP) };
+struct array { unsigned x[64]; };
+
+inline flat make_flat(unsigned v) { return {XREPEAT((4)(0),INIT,COMMA)}; }
+
+inline array make_array(unsigned v)
+{
+  array a;
+  for (unsigned i = 0; i != 64; ++i)
+    a.x[i] = v + i * i;
+  return a;
+}
+
+int main()
+{
+  constexpr unsigned n = 1 << 16;
+  std::mt19937 rng(42);
+
+  std::vector<unsigned char> bytes(n + 32);
+  for (auto& b : bytes) b = static_cast<unsigned char>(rng());
+  std::vector<int> ints(n + 16);
+  for (auto& i : ints) i = static_cast<int>(rng() % 1000);
+  unsigned char const* p = bytes.data();
+  int const* q = ints.data();
+
+  std::printf("Unrolled loops, 2^16 ops:\n");
+  bench("FNV-1a 32 bytes XREPEAT", n, [p] {
+    unsigned s = 0;
+    for (unsigned i = 0; i != n; ++i) s += fnv_unrolled(p + i);
+    keep(s);
+  });
+  bench("FNV-1a 32 bytes loop", n, [p] {
+    unsigned s = 0;
+    for (unsigned i = 0; i != n; ++i) s += fnv_loop(p + i);
+    keep(s);
+  });
+  bench("dot 16 ints XREPEAT", n, [q] {
+    int s = 0;
+    for (unsigned i = 0; i != n; ++i) s += dot_unrolled(q + i, q + (i ^ 8));
+    keep(s);
+  });
+  bench("dot 16 ints loop", n, [q] {
+    int s = 0;
+    for (unsigned i = 0; i != n; ++i) s += dot_loop(q + i, q + (i ^ 8));
+    keep(s);
+  });
+
+  unsigned (*op_ptrs[256])(unsigned);
+  fill<256>(op_ptrs);
+  std::vector<std::function<unsigned(unsigned)>> op_table;
+  for (unsigned k = 0; k != 256; ++k)
+    op_table.push_back([k](unsigned x) { return ROTX(k,x); });
+
+  std::printf("256-way dispatch, random k, 2^16 ops:\n");
+  bench("switch XREPEAT", n, [p] {
+    unsigned x = 1;
+    for (unsigned i = 0; i != n; ++i) x += op_switch(p[i], x);
+    keep(x);
+  });
+  bench("function pointer table", n, [p,&op_ptrs] {
+    unsigned x = 1;
+    for (unsigned i = 0; i != n; ++i) x += op_ptrs[p[i]](x);
+    keep(x);
+  });
+  bench("std::function, k captured", n, [p,&op_table] {
+    unsigned x = 1;
+    for (unsigned i = 0; i != n; ++i) x += op_table[p[i]](x);
+    keep(x);
+  });
+
+  std::vector<unsigned char> rev_runtime(256);
+  for (unsigned b = 0; b != 256; ++b)
+    rev_runtime[b] = rev_bits(static_cast<unsigned char>(b));
+
+  std::printf("Byte bit reversal lookup, 2^16 ops:\n");
+  bench("constexpr table XREPEAT", n, [p] {
+    unsigned s = 0;
+    for (unsigned i = 0; i != n; ++i) s = s * 3 + rev_table[p[i] ^ (s & 1)];
+    keep(s);
+  });
+  bench("table filled at startup", n, [p,&rev_runtime] {
+    unsigned s = 0;
+    for (unsigned i = 0; i != n; ++i) s = s * 3 + rev_runtime[p[i] ^ (s & 1)];
+    keep(s);
+  });
+  bench("computed bit by bit", n, [p] {
+    unsigned s = 0;
+    for (unsigned i = 0; i != n; ++i)
+      s = s * 3 + rev_bits(static_cast<unsigned char>(p[i] ^ (s & 1)));
+    keep(s);
+  });
+
+  constexpr unsigned structs = 1 << 10;
+  std::vector<flat> flats(structs);
+  std::vector<array> arrays(structs);
+
+  std::printf("Struct of 64 unsigned init, 2^10 ops:\n");
+  bench("flat members XREPEAT", structs, [&flats] {
+    for (unsigned i = 0; i != structs; ++i) flats[i] = make_flat(i);
+    keep(flats[structs - 1].x3f);
+  });
+  bench("array member loop", structs, [&arrays] {
+    for (unsigned i = 0; i != structs; ++i) arrays[i] = make_array(i);
+    keep(arrays[structs - 1].x[63]);
+  });
+}
+
+#undef FNV
+#undef DOT
+#undef ROTX
+#undef OP_CASE
+#undef REV
+#undef MEMBER
+#undef INIT
+
+#include "IREPEAT_UNDEF.hpp"
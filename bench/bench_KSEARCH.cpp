@@ -0,0 +1,96 @@
+#include "IREPEAT.hpp"
+#include "KSEARCH.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <random>
+
+/*
+   Runtime benchmark of KSEARCH.hpp constant key searches against
+   std::lower_bound and a generated switch, for 16 and 256 keys.
+
+   Each method finds the index of key x, or the key count on a miss.
+   Hit-heavy lookups are all keys; miss-heavy lookups are 90% misses.
+ */
+
+// Irregular keys 1,5,11,19,... with misses between them;
+// evenly spaced keys let the compiler compute the switch
+#define KEY(H) (HEXLIT(H)+3)*HEXLIT(H)+1
+
+KSEARCH(ksearch16,unsigned,(1)(0),KEY)
+KSEARCH(ksearch256,unsigned,(1)(0)(0),KEY)
+KRANK(krank16,unsigned,(1)(0),KEY)
+KRANK(krank256,unsigned,(1)(0)(0),KEY)
+
+constexpr unsigned keys[] {XREPEAT((1)(0)(0),KEY,COMMA)};
+
+// found(n,i,x): i if key i is x else n, for a lower bound index i
+inline unsigned found(unsigned n, unsigned i, unsigned x)
+{
+  return i != n && keys[i] == x ? i : n;
+}
+
+#define CASE(H) case KEY(H): return HEXLIT(H);
+
+unsigned switch16(unsigned x)
+{
+  switch (x) { XREPEAT((1)(0),CASE,NOSEP) default: return 16; }
+}
+
+unsigned switch256(unsigned x)
+{
+  switch (x) { XREPEAT((1)(0)(0),CASE,NOSEP) default: return 256; }
+}
+
+template <unsigned N>
+unsigned lower_bound(unsigned x)
+{
+  return found(N, static_cast<unsigned>(
+                  std::lower_bound(keys, keys + N, x) - keys), x);
+}
+
+unsigned find_ksearch16(unsigned x) { return found(16,ksearch16(x),x); }
+unsigned find_ksearch256(unsigned x) { return found(256,ksearch256(x),x); }
+unsigned find_krank16(unsigned x) { return found(16,krank16(x),x); }
+unsigned find_krank256(unsigned x) { return found(256,krank256(x),x); }
+
+int main()
+{
+  constexpr unsigned lookups = 1 << 16;
+  std::mt19937 rng(42);
+
+  for (unsigned n : {16u, 256u}) {
+    std::vector<unsigned> hits(lookups), misses(lookups);
+    for (auto& x : hits) x = keys[rng() % n];
+    for (auto& x : misses)
+      x = rng() % 10 ? keys[rng() % n] + 1 : keys[rng() % n];
+
+    for (auto* xs : {&hits, &misses}) {
+      auto run = [xs](unsigned (*find)(unsigned)) {
+        return [xs,find] {
+          unsigned sum = 0;
+          for (unsigned x : *xs) sum += find(x);
+          keep(sum);
+        };
+      };
+      std::printf("%u keys, %s-heavy lookups:\n",
+                  n, xs == &hits ? "hit" : "miss");
+      if (n == 16) {
+        bench("KSEARCH", lookups, run(find_ksearch16));
+        bench("KRANK", lookups, run(find_krank16));
+        bench("std::lower_bound", lookups, run(lower_bound<16>));
+        bench("switch", lookups, run(switch16));
+      } else {
+        bench("KSEARCH", lookups, run(find_ksearch256));
+        bench("KRANK", lookups, run(find_krank256));
+        bench("std::lower_bound", lookups, run(lower_bound<256>));
+        bench("switch", lookups, run(switch256));
+      }
+    }
+  }
+}
+
+#undef KEY
+#undef CASE
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,58 @@
+#include "IREPEAT.hpp"
+#include "SHARDS.hpp"
+#include "bench.hpp"
+
+#include <atomic>
+#include <thread>
+
+/*
+   Multithreaded benchmark of SHARDS.hpp cache line padded counters
+   against unpadded adjacent counters and a single shared counter.
+
+   Each of 1 to 16 threads does relaxed atomic increments of its own
+   slot, or of the one shared counter; ns/op is wall time divided
+   by the total increments of all threads. False sharing shows only
+   when threads run on separate cores.
+ */
+
+using counter = std::atomic<unsigned long>;
+
+SHARDS(padded,counter,(1)(0))
+
+struct unpadded { counter slot[16]; };
+
+padded pad;
+unpadded unpad;
+counter shared;
+
+constexpr unsigned increments = 1 << 20;
+
+template <typename Slot>
+void threads(char const* name, unsigned n, Slot slot)
+{
+  bench(name, double(n) * increments, [n,slot] {
+    std::vector<std::thread> ts;
+    for (unsigned t = 0; t != n; ++t)
+      ts.emplace_back([t,slot] {
+        counter& c = slot(t);
+        for (unsigned i = 0; i != increments; ++i)
+          c.fetch_add(1, std::memory_order_relaxed);
+      });
+    for (auto& t : ts) t.join();
+  }, 5);
+}
+
+int main()
+{
+  std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+  for (unsigned n : {1u, 2u, 4u, 8u, 16u}) {
+    std::printf("%u threads, ns/increment:\n", n);
+    threads("SHARDS padded", n, [](unsigned t) -> counter& { return pad[t]; });
+    threads("unpadded", n,
+            [](unsigned t) -> counter& { return unpad.slot[t]; });
+    threads("shared", n, [](unsigned) -> counter& { return shared; });
+  }
+  keep(pad.sum() + shared.load());
+}
+
+#include "IREPEAT_UNDEF.hpp"
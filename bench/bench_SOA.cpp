@@ -0,0 +1,97 @@
+#include "IREPEAT.hpp"
+#include "SOA.hpp"
+#include "bench.hpp"
+
+/*
+   Runtime benchmark of SOA.hpp field scans against the equivalent
+   array of structs, for 2^16 and 2^20 entities of 8 int fields, e.g. fixed point,
+   so that the sums vectorize without reassociating floats.
+   Built -O3 as GCC -O2 does not vectorize these loops.
+
+   Scans read one field (sum of mass), update three fields from
+   three others (position += velocity) or read all eight fields.
+ */
+
+#define ENTITY(H) CAT(ENTITY_,SEQCAT(H))
+#define ENTITY_0 (int,x)
+#define ENTITY_1 (int,y)
+#define ENTITY_2 (int,z)
+#define ENTITY_3 (int,vx)
+#define ENTITY_4 (int,vy)
+#define ENTITY_5 (int,vz)
+#define ENTITY_6 (int,mass)
+#define ENTITY_7 (int,charge)
+
+SOA(soa16,(8),ENTITY,(1)(0)(0)(0)(0))
+SOA(soa20,(8),ENTITY,(1)(0)(0)(0)(0)(0))
+
+struct entity { int x, y, z, vx, vy, vz, mass, charge; };
+
+soa16 s16;
+soa20 s20;
+entity a16[soa16::capacity];
+entity a20[soa20::capacity];
+
+template <typename S>
+void scans(S& s, entity* a, unsigned n)
+{
+  for (unsigned i = 0; i != n; ++i) {
+    s[i].x = a[i].x = int(i % 7);
+    s[i].vx = a[i].vx = s[i].mass = a[i].mass = 1;
+  }
+  std::printf("%u entities, ns/entity:\n", n);
+  bench("SoA sum mass", n, [&s, a, n] {
+    int sum = 0;
+    for (unsigned i = 0; i != n; ++i) sum += s.mass[i];
+    keep(sum);
+  });
+  bench("AoS sum mass", n, [&s, a, n] {
+    int sum = 0;
+    for (unsigned i = 0; i != n; ++i) sum += a[i].mass;
+    keep(sum);
+  });
+  bench("SoA position += velocity", n, [&s, a, n] {
+    for (unsigned i = 0; i != n; ++i) {
+      s.x[i] += s.vx[i]; s.y[i] += s.vy[i]; s.z[i] += s.vz[i];
+    }
+    keep(s.x[n / 2]);
+  });
+  bench("AoS position += velocity", n, [&s, a, n] {
+    for (unsigned i = 0; i != n; ++i) {
+      a[i].x += a[i].vx; a[i].y += a[i].vy; a[i].z += a[i].vz;
+    }
+    keep(a[n / 2].x);
+  });
+  bench("SoA sum all fields", n, [&s, a, n] {
+    int sum = 0;
+    for (unsigned i = 0; i != n; ++i)
+      sum += s.x[i] + s.y[i] + s.z[i] + s.vx[i]
+           + s.vy[i] + s.vz[i] + s.mass[i] + s.charge[i];
+    keep(sum);
+  });
+  bench("AoS sum all fields", n, [&s, a, n] {
+    int sum = 0;
+    for (unsigned i = 0; i != n; ++i)
+      sum += a[i].x + a[i].y + a[i].z + a[i].vx
+           + a[i].vy + a[i].vz + a[i].mass + a[i].charge;
+    keep(sum);
+  });
+}
+
+int main()
+{
+  scans(s16, a16, soa16::capacity);
+  scans(s20, a20, soa20::capacity);
+}
+
+#undef ENTITY
+#undef ENTITY_0
+#undef ENTITY_1
+#undef ENTITY_2
+#undef ENTITY_3
+#undef ENTITY_4
+#undef ENTITY_5
+#undef ENTITY_6
+#undef ENTITY_7
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,71 @@
+#include "IREPEAT.hpp"
+#include "SORTNET.hpp"
+#include "bench.hpp"
+
+#include <algorithm>
+#include <random>
+
+/*
+   Runtime benchmark of SORTNET.hpp networks against std::sort and
+   insertion sort, sorting many small random int arrays of N = 4..32.
+
+   Each method copies each array to a local buffer and sorts it;
+   the copy is common to all methods.
+ */
+
+SORTNET(sortnet4,int,(4))
+SORTNET(sortnet8,int,(8))
+SORTNET(sortnet12,int,(c))
+SORTNET(sortnet16,int,(1)(0))
+SORTNET(sortnet24,int,(1)(8))
+SORTNET(sortnet32,int,(2)(0))
+
+void insertion_sort(int* a, unsigned n)
+{
+  for (unsigned i = 1; i < n; ++i) {
+    int x = a[i];
+    unsigned j = i;
+    for (; j != 0 && x < a[j - 1]; --j) a[j] = a[j - 1];
+    a[j] = x;
+  }
+}
+
+template <unsigned N, typename Sort>
+void sorts(std::vector<int> const& data, char const* name, Sort sort)
+{
+  bench(name, double(data.size()) / N, [&data,sort] {
+    int sum = 0;
+    for (unsigned i = 0; i != data.size(); i += N) {
+      int a[N];
+      std::copy(&data[i], &data[i] + N, a);
+      sort(a);
+      sum += a[0] - a[N - 1];
+    }
+    keep(sum);
+  });
+}
+
+template <unsigned N>
+void bench_n(void (*sortnet)(int*))
+{
+  std::mt19937 rng(42);
+  std::vector<int> data(N << 12);
+  for (int& x : data) x = int(rng() % 1000);
+
+  std::printf("%u elements, ns/array:\n", N);
+  sorts<N>(data, "SORTNET", sortnet);
+  sorts<N>(data, "std::sort", [](int* a) { std::sort(a, a + N); });
+  sorts<N>(data, "insertion sort", [](int* a) { insertion_sort(a, N); });
+}
+
+int main()
+{
+  bench_n<4>(sortnet4);
+  bench_n<8>(sortnet8);
+  bench_n<12>(sortnet12);
+  bench_n<16>(sortnet16);
+  bench_n<24>(sortnet24);
+  bench_n<32>(sortnet32);
+}
+
+#include "IREPEAT_UNDEF.hpp"
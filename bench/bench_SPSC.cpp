@@ -0,0 +1,80 @@
+#include "IREPEAT.hpp"
+#include "SPSC.hpp"
+#include "bench.hpp"
+
+#include <thread>
+
+/*
+   Two-thread benchmark of SPSC.hpp ring buffer batch transfer.
+
+   A producer thread pushes 2^20 values through a ring of 1024 to a
+   consumer thread, which sums them, in batches of B, 1 to 64, by
+   push_n<B> and pop_n<B>, and as B calls each of push and pop.
+   Either thread yields when its batch doesn't fit. ns/op is wall
+   time divided by the values transferred. Threads run concurrently
+   only on a multi-core machine.
+ */
+
+SPSC(queue,unsigned,(4)(0)(0))
+
+queue q;
+
+constexpr unsigned values = 1 << 20;
+
+// transfer<B>(name,push,pop): time values through q in batches of B
+template <unsigned B, typename Push, typename Pop>
+void transfer(char const* name, Push push, Pop pop)
+{
+  bench(name, values, [push,pop] {
+    std::thread consumer([pop] {
+      unsigned batch[B], sum = 0;
+      for (unsigned n = 0; n != values; n += B) {
+        while (!pop(batch))
+          std::this_thread::yield();
+        for (unsigned x : batch) sum += x;
+      }
+      keep(sum);
+    });
+    unsigned batch[B];
+    for (unsigned n = 0; n != values; n += B) {
+      for (unsigned i = 0; i != B; ++i) batch[i] = n + i;
+      while (!push(batch))
+        std::this_thread::yield();
+    }
+    consumer.join();
+  });
+}
+
+// run<B>(): batch B by push_n<B>, pop_n<B>, and element by element
+template <unsigned B>
+void run()
+{
+  std::printf("batch %u, ns/value:\n", B);
+  transfer<B>("SPSC push_n, pop_n",
+              [](unsigned const* b) { return q.push_n<B>(b); },
+              [](unsigned* b) { return q.pop_n<B>(b); });
+  // all or none, as push_n and pop_n, by waiting for each element
+  transfer<B>("SPSC push, pop per element",
+              [](unsigned const* b) {
+                for (unsigned i = 0; i != B; ++i)
+                  while (!q.push(b[i])) std::this_thread::yield();
+                return true; },
+              [](unsigned* b) {
+                for (unsigned i = 0; i != B; ++i)
+                  while (!q.pop(b[i])) std::this_thread::yield();
+                return true; });
+}
+
+int main()
+{
+  std::printf("%u hardware threads\n", std::thread::hardware_concurrency());
+  run<1>();
+  run<2>();
+  run<4>();
+  run<8>();
+  run<16>();
+  run<32>();
+  run<64>();
+}
+
+#include "IREPEAT_UNDEF.hpp"
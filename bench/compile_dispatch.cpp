@@ -0,0 +1,69 @@
+#if 0
+ SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+ SPDX-License-Identifier: BSL-1.0
+
+ Compile time benchmark source, compiled by compile_dispatch.py.
+ Defines unsigned dispatch(n,x) returning kernel<n>(x) for n < N,
+ with one of the dispatch methods selected by -D, each forwarding
+ the x argument by reference as DISPATCH does:
+
+   BENCH_DISPATCH_CALL    DISPATCH call, COUNT = N as HEXS
+   BENCH_DISPATCH_JUMP    DISPATCH jump, COUNT = N as HEXS
+   BENCH_SEQ_TABLE        index_sequence pointer table, N
+   BENCH_SEQ_FOLD         index_sequence fold over ||, N
+#endif
+
+#include <utility>
+
+template <unsigned K>
+unsigned kernel(unsigned x) { return (x ^ K) * (2 * K + 1); }
+
+#if defined(BENCH_DISPATCH_CALL) || defined(BENCH_DISPATCH_JUMP)
+
+#include "IREPEAT.hpp"
+#include "DISPATCH.hpp"
+
+DISPATCH(dispatcher,COUNT,kernel)
+
+unsigned dispatch(unsigned n, unsigned x)
+{
+#if defined(BENCH_DISPATCH_CALL)
+  return dispatcher::call(n,x);
+#else
+  return dispatcher::jump(n,x);
+#endif
+}
+
+#include "IREPEAT_UNDEF.hpp"
+
+#elif defined(BENCH_SEQ_TABLE)
+
+template <unsigned... I, typename... A>
+unsigned seq_table(std::integer_sequence<unsigned,I...>, unsigned n, A&&... a)
+{
+  static constexpr unsigned (*table[])(unsigned) {&kernel<I>...};
+  return table[n](static_cast<A&&>(a)...);
+}
+
+unsigned dispatch(unsigned n, unsigned x)
+{
+  return seq_table(std::make_integer_sequence<unsigned,N>{}, n, x);
+}
+
+#elif defined(BENCH_SEQ_FOLD)
+
+template <unsigned... I, typename... A>
+unsigned seq_fold(std::integer_sequence<unsigned,I...>, unsigned n, A&&... a)
+{
+  unsigned r = 0;
+  static_cast<void>(((n == I && (r = kernel<I>(static_cast<A&&>(a)...), true))
+                    || ...));
+  return r;
+}
+
+unsigned dispatch(unsigned n, unsigned x)
+{
+  return seq_fold(std::make_integer_sequence<unsigned,N>{}, n, x);
+}
+
+#endif
@@ -0,0 +1,65 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Compare compile time and peak memory of DISPATCH.hpp against
+std::index_sequence dispatch, for 256, 1024 and 4096 kernels.
+
+  compile_dispatch.py <irepeat include dir> <GCC style compiler command...>
+
+Each method compiles compile_dispatch.cpp with -c -std=c++17 to the
+same runtime index dispatch, at -O0 for the front end cost of the
+expansion and at -O2 for the total; see the comment in that file.
+"""
+import os
+import subprocess
+import sys
+import time
+
+METHODS = ['DISPATCH_CALL', 'DISPATCH_JUMP', 'SEQ_TABLE', 'SEQ_FOLD']
+
+# (kernels, COUNT as HEXS)
+SIZES = [(256, '(1)(0)(0)'),
+         (1024, '(4)(0)(0)'),
+         (4096, '(1)(0)(0)(0)')]
+
+
+def run(cmd):
+    """Run cmd, return (wall seconds, peak RSS in MB) of the child;
+    RSS is nan without os.wait4, as on Windows."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(proc.pid, 0)
+        mb = usage.ru_maxrss / 1024
+    else:
+        status, mb = proc.wait(), float('nan')
+    secs = time.perf_counter() - start
+    if status != 0:
+        sys.exit('failed: ' + ' '.join(cmd))
+    return secs, mb
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+    srcdir = os.path.dirname(os.path.abspath(__file__))
+    src = os.path.join(srcdir, 'compile_dispatch.cpp')
+
+    print('%-14s %8s %4s %10s %10s'
+          % ('method', 'kernels', 'opt', 'time (s)', 'RSS (MB)'))
+    for kernels, count in SIZES:
+        for method in METHODS:
+            for opt in ['-O0', '-O2']:
+                secs, mb = run(cxx + ['-c', opt, '-std=c++17',
+                                      '-o', os.devnull, '-I' + incdir,
+                                      '-DBENCH_' + method, '-DN=%d' % kernels,
+                                      '-DCOUNT=' + count, src])
+                print('%-14s %8d %4s %10.2f %10.0f'
+                      % (method, kernels, opt, secs, mb))
+                sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,156 @@
+#if 0
+ SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+ SPDX-License-Identifier: BSL-1.0
+
+ Preprocessing benchmark source, run with -E by pp_compare.py.
+ Generates the same iota array and struct member list of HI*256
+ elements with one of the repetition methods, selected by -D:
+
+   BENCH_IREPEAT          IREPEAT, COUNT = HI*256-1 as HEXS
+   BENCH_VREPEAT          VREPEAT, COUNT = HI*256-1 as HEXS
+   BENCH_BOOST_REPEAT     BOOST_PP_REPEAT, nested for HI > 1
+   BENCH_BOOST_LOCAL      BOOST_PP_LOCAL_ITERATE, in a file
+                          iteration over HI
+   BENCH_BOOST_ITERATE    BOOST_PP_ITERATE, nested for HI > 1
+
+ Every method emits the same tokens, as IREPEAT HEXLIT and x0D,
+ e.g. 0x0a5, and x0a5 for element 165 of 4096, each literal with a
+ trailing comma. The Boost methods iterate in decimal, over HI and
+ 256, so map each decimal number to its hex digits by table lookup,
+ HEX2_n for the low two digits and HIGH(hi) for the rest, as fits
+ HI, then paste the 0x or x prefix. The tables are kept apart, in
+ pp_compare_hex.hpp, as the file iterations include this file once
+ per element.
+#endif
+
+#if defined(BENCH_BOOST_REPEAT) || defined(BENCH_BOOST_LOCAL) \
+ || defined(BENCH_BOOST_ITERATE)
+#  if !BOOST_PP_IS_ITERATING
+#    include <boost/preprocessor/cat.hpp>
+#    include "pp_compare_hex.hpp"
+#    if HI == 1
+#      define HIGH(hi)
+#    elif HI == 16
+#      define HIGH(hi) BOOST_PP_CAT(HEX1_,hi)
+#    else
+#      define HIGH(hi) BOOST_PP_CAT(HEX2_,hi)
+#    endif
+#    define PASTE_(P,H,L) P##H##L
+#    define PASTE(P,H,L) PASTE_(P,H,L)
+#    define LIT(hi,lo) PASTE(0x,HIGH(hi),BOOST_PP_CAT(HEX2_,lo))
+#    define NAME(hi,lo) PASTE(x,HIGH(hi),BOOST_PP_CAT(HEX2_,lo))
+#  endif
+#endif
+
+#if defined(BENCH_IREPEAT)
+
+#include "IREPEAT.hpp"
+#define IOTA(H) HEXLIT(H),
+#define MEMBER(H) int x0D(H);
+unsigned iota[] {IREPEAT(COUNT,IOTA,NOSEP)};
+struct members {IREPEAT(COUNT,MEMBER,NOSEP)};
+#undef IOTA
+#undef MEMBER
+#include "IREPEAT_UNDEF.hpp"
+
+#elif defined(BENCH_VREPEAT)
+
+#include "IREPEAT.hpp"
+#define IOTA(H) HEXLIT(H),
+#define VREPEAT_COUNT COUNT
+#define VREPEAT_MACRO IOTA
+unsigned iota[] {
+#include "VREPEAT.hpp"
+};
+#define MEMBER(H) int x0D(H);
+#define VREPEAT_COUNT COUNT
+#define VREPEAT_MACRO MEMBER
+struct members {
+#include "VREPEAT.hpp"
+};
+#undef IOTA
+#undef MEMBER
+#include "IREPEAT_UNDEF.hpp"
+
+#elif defined(BENCH_BOOST_REPEAT)
+
+#include <boost/preprocessor/repetition/repeat.hpp>
+#if HI == 1
+#define IOTA(z,n,_) LIT(0,n),
+#define MEMBER(z,n,_) int NAME(0,n);
+unsigned iota[] {BOOST_PP_REPEAT(256,IOTA,~)};
+struct members {BOOST_PP_REPEAT(256,MEMBER,~)};
+#else
+#define IOTA(z,lo,hi) LIT(hi,lo),
+#define IOTAS(z,hi,_) BOOST_PP_REPEAT_##z(256,IOTA,hi)
+#define MEMBER(z,lo,hi) int NAME(hi,lo);
+#define MEMBERS(z,hi,_) BOOST_PP_REPEAT_##z(256,MEMBER,hi)
+unsigned iota[] {BOOST_PP_REPEAT(HI,IOTAS,~)};
+struct members {BOOST_PP_REPEAT(HI,MEMBERS,~)};
+#endif
+
+#elif defined(BENCH_BOOST_LOCAL)
+
+#if !BOOST_PP_IS_ITERATING
+#  include <boost/preprocessor/iteration/iterate.hpp>
+#  include <boost/preprocessor/iteration/local.hpp>
+#  define PHASE_IOTA
+#  define BOOST_PP_ITERATION_PARAMS_1 (3,(0,HI-1,"pp_compare.cpp"))
+unsigned iota[] {
+#  include BOOST_PP_ITERATE()
+};
+#  undef PHASE_IOTA
+#  define BOOST_PP_ITERATION_PARAMS_1 (3,(0,HI-1,"pp_compare.cpp"))
+struct members {
+#  include BOOST_PP_ITERATE()
+};
+#else
+#  if defined(PHASE_IOTA)
+#    define BOOST_PP_LOCAL_MACRO(n) LIT(BOOST_PP_ITERATION(),n),
+#  else
+#    define BOOST_PP_LOCAL_MACRO(n) int NAME(BOOST_PP_ITERATION(),n);
+#  endif
+#  define BOOST_PP_LOCAL_LIMITS (0,255)
+#  include BOOST_PP_LOCAL_ITERATE()
+#endif
+
+#elif defined(BENCH_BOOST_ITERATE)
+
+#if !BOOST_PP_IS_ITERATING
+#  include <boost/preprocessor/iteration/iterate.hpp>
+#  if HI == 1
+#    define BOOST_PP_ITERATION_PARAMS_1 (3,(0,255,"pp_compare.cpp"))
+#  else
+#    define BOOST_PP_ITERATION_PARAMS_1 (3,(0,HI-1,"pp_compare.cpp"))
+#  endif
+#  define PHASE_IOTA
+unsigned iota[] {
+#  include BOOST_PP_ITERATE()
+};
+#  undef PHASE_IOTA
+#  if HI == 1
+#    define BOOST_PP_ITERATION_PARAMS_1 (3,(0,255,"pp_compare.cpp"))
+#  else
+#    define BOOST_PP_ITERATION_PARAMS_1 (3,(0,HI-1,"pp_compare.cpp"))
+#  endif
+struct members {
+#  include BOOST_PP_ITERATE()
+};
+#elif HI != 1 && BOOST_PP_ITERATION_DEPTH() == 1
+#  define BOOST_PP_ITERATION_PARAMS_2 (3,(0,255,"pp_compare.cpp"))
+#  include BOOST_PP_ITERATE()
+#else
+#  if HI == 1
+#    define ITER_HI 0
+#  else
+#    define ITER_HI BOOST_PP_RELATIVE_ITERATION(1)
+#  endif
+#  if defined(PHASE_IOTA)
+LIT(ITER_HI,BOOST_PP_ITERATION()),
+#  else
+int NAME(ITER_HI,BOOST_PP_ITERATION());
+#  endif
+#  undef ITER_HI
+#endif
+
+#endif
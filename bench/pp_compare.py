@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Compare preprocessing time and peak memory of IREPEAT and VREPEAT
+against Boost.Preprocessor repetition, for 256, 4096 and 65536 reps.
+
+  pp_compare.py <irepeat include dir> <GCC style compiler command...>
+
+Each method preprocesses pp_compare.cpp with -E to generate the same
+iota array and struct member list; see the comment in that file.
+The outputs are checked to be the same tokens, method by method.
+"""
+import os
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+METHODS = ['IREPEAT', 'VREPEAT',
+           'BOOST_REPEAT', 'BOOST_LOCAL', 'BOOST_ITERATE']
+
+# (reps, HI = reps/256, COUNT = reps-1 as HEXS)
+SIZES = [(256, 1, '(f)(f)'),
+         (4096, 16, '(f)(f)(f)'),
+         (65536, 256, '(f)(f)(f)(f)')]
+
+
+def run(cmd):
+    """Run cmd, return (wall seconds, peak RSS in MB) of the child;
+    RSS is nan without os.wait4, as on Windows."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(proc.pid, 0)
+        mb = usage.ru_maxrss / 1024
+    else:
+        status, mb = proc.wait(), float('nan')
+    secs = time.perf_counter() - start
+    if status != 0:
+        sys.exit('failed: ' + ' '.join(cmd))
+    return secs, mb
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+    srcdir = os.path.dirname(os.path.abspath(__file__))
+    src = os.path.join(srcdir, 'pp_compare.cpp')
+
+    tmpdir = tempfile.TemporaryDirectory()
+    out = os.path.join(tmpdir.name, 'pp_compare.i')
+
+    print('%-14s %8s %10s %10s' % ('method', 'reps', 'time (s)', 'RSS (MB)'))
+    for reps, hi, count in SIZES:
+        first = None
+        for method in METHODS:
+            secs, mb = run(cxx + ['-E', '-P', '-I' + incdir, '-I' + srcdir,
+                                  '-DBENCH_' + method, '-DHI=%d' % hi,
+                                  '-DCOUNT=' + count, src, '-o', out])
+            print('%-14s %8d %10.2f %10.0f' % (method, reps, secs, mb))
+            sys.stdout.flush()
+            with open(out) as f:
+                tokens = re.findall(r'\w+|\S', f.read())
+            if first is None:
+                first = tokens
+            elif tokens != first:
+                sys.exit('output differs from %s: %s' % (METHODS[0], method))
+    tmpdir.cleanup()
+
+
+if __name__ == '__main__':
+    main()
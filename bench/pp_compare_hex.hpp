@@ -0,0 +1,281 @@
+#if 0
+ SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+ SPDX-License-Identifier: BSL-1.0
+
+ Decimal to hex digit tables for the Boost methods of pp_compare.cpp:
+ HEX1_n is the hex digit of n < 16, HEX2_n the two hex digits of
+ n < 256, with a leading zero.
+#endif
+
+#define HEX1_0 0
+#define HEX1_1 1
+#define HEX1_2 2
+#define HEX1_3 3
+#define HEX1_4 4
+#define HEX1_5 5
+#define HEX1_6 6
+#define HEX1_7 7
+#define HEX1_8 8
+#define HEX1_9 9
+#define HEX1_10 a
+#define HEX1_11 b
+#define HEX1_12 c
+#define HEX1_13 d
+#define HEX1_14 e
+#define HEX1_15 f
+#define HEX2_0 00
+#define HEX2_1 01
+#define HEX2_2 02
+#define HEX2_3 03
+#define HEX2_4 04
+#define HEX2_5 05
+#define HEX2_6 06
+#define HEX2_7 07
+#define HEX2_8 08
+#define HEX2_9 09
+#define HEX2_10 0a
+#define HEX2_11 0b
+#define HEX2_12 0c
+#define HEX2_13 0d
+#define HEX2_14 0e
+#define HEX2_15 0f
+#define HEX2_16 10
+#define HEX2_17 11
+#define HEX2_18 12
+#define HEX2_19 13
+#define HEX2_20 14
+#define HEX2_21 15
+#define HEX2_22 16
+#define HEX2_23 17
+#define HEX2_24 18
+#define HEX2_25 19
+#define HEX2_26 1a
+#define HEX2_27 1b
+#define HEX2_28 1c
+#define HEX2_29 1d
+#define HEX2_30 1e
+#define HEX2_31 1f
+#define HEX2_32 20
+#define HEX2_33 21
+#define HEX2_34 22
+#define HEX2_35 23
+#define HEX2_36 24
+#define HEX2_37 25
+#define HEX2_38 26
+#define HEX2_39 27
+#define HEX2_40 28
+#define HEX2_41 29
+#define HEX2_42 2a
+#define HEX2_43 2b
+#define HEX2_44 2c
+#define HEX2_45 2d
+#define HEX2_46 2e
+#define HEX2_47 2f
+#define HEX2_48 30
+#define HEX2_49 31
+#define HEX2_50 32
+#define HEX2_51 33
+#define HEX2_52 34
+#define HEX2_53 35
+#define HEX2_54 36
+#define HEX2_55 37
+#define HEX2_56 38
+#define HEX2_57 39
+#define HEX2_58 3a
+#define HEX2_59 3b
+#define HEX2_60 3c
+#define HEX2_61 3d
+#define HEX2_62 3e
+#define HEX2_63 3f
+#define HEX2_64 40
+#define HEX2_65 41
+#define HEX2_66 42
+#define HEX2_67 43
+#define HEX2_68 44
+#define HEX2_69 45
+#define HEX2_70 46
+#define HEX2_71 47
+#define HEX2_72 48
+#define HEX2_73 49
+#define HEX2_74 4a
+#define HEX2_75 4b
+#define HEX2_76 4c
+#define HEX2_77 4d
+#define HEX2_78 4e
+#define HEX2_79 4f
+#define HEX2_80 50
+#define HEX2_81 51
+#define HEX2_82 52
+#define HEX2_83 53
+#define HEX2_84 54
+#define HEX2_85 55
+#define HEX2_86 56
+#define HEX2_87 57
+#define HEX2_88 58
+#define HEX2_89 59
+#define HEX2_90 5a
+#define HEX2_91 5b
+#define HEX2_92 5c
+#define HEX2_93 5d
+#define HEX2_94 5e
+#define HEX2_95 5f
+#define HEX2_96 60
+#define HEX2_97 61
+#define HEX2_98 62
+#define HEX2_99 63
+#define HEX2_100 64
+#define HEX2_101 65
+#define HEX2_102 66
+#define HEX2_103 67
+#define HEX2_104 68
+#define HEX2_105 69
+#define HEX2_106 6a
+#define HEX2_107 6b
+#define HEX2_108 6c
+#define HEX2_109 6d
+#define HEX2_110 6e
+#define HEX2_111 6f
+#define HEX2_112 70
+#define HEX2_113 71
+#define HEX2_114 72
+#define HEX2_115 73
+#define HEX2_116 74
+#define HEX2_117 75
+#define HEX2_118 76
+#define HEX2_119 77
+#define HEX2_120 78
+#define HEX2_121 79
+#define HEX2_122 7a
+#define HEX2_123 7b
+#define HEX2_124 7c
+#define HEX2_125 7d
+#define HEX2_126 7e
+#define HEX2_127 7f
+#define HEX2_128 80
+#define HEX2_129 81
+#define HEX2_130 82
+#define HEX2_131 83
+#define HEX2_132 84
+#define HEX2_133 85
+#define HEX2_134 86
+#define HEX2_135 87
+#define HEX2_136 88
+#define HEX2_137 89
+#define HEX2_138 8a
+#define HEX2_139 8b
+#define HEX2_140 8c
+#define HEX2_141 8d
+#define HEX2_142 8e
+#define HEX2_143 8f
+#define HEX2_144 90
+#define HEX2_145 91
+#define HEX2_146 92
+#define HEX2_147 93
+#define HEX2_148 94
+#define HEX2_149 95
+#define HEX2_150 96
+#define HEX2_151 97
+#define HEX2_152 98
+#define HEX2_153 99
+#define HEX2_154 9a
+#define HEX2_155 9b
+#define HEX2_156 9c
+#define HEX2_157 9d
+#define HEX2_158 9e
+#define HEX2_159 9f
+#define HEX2_160 a0
+#define HEX2_161 a1
+#define HEX2_162 a2
+#define HEX2_163 a3
+#define HEX2_164 a4
+#define HEX2_165 a5
+#define HEX2_166 a6
+#define HEX2_167 a7
+#define HEX2_168 a8
+#define HEX2_169 a9
+#define HEX2_170 aa
+#define HEX2_171 ab
+#define HEX2_172 ac
+#define HEX2_173 ad
+#define HEX2_174 ae
+#define HEX2_175 af
+#define HEX2_176 b0
+#define HEX2_177 b1
+#define HEX2_178 b2
+#define HEX2_179 b3
+#define HEX2_180 b4
+#define HEX2_181 b5
+#define HEX2_182 b6
+#define HEX2_183 b7
+#define HEX2_184 b8
+#define HEX2_185 b9
+#define HEX2_186 ba
+#define HEX2_187 bb
+#define HEX2_188 bc
+#define HEX2_189 bd
+#define HEX2_190 be
+#define HEX2_191 bf
+#define HEX2_192 c0
+#define HEX2_193 c1
+#define HEX2_194 c2
+#define HEX2_195 c3
+#define HEX2_196 c4
+#define HEX2_197 c5
+#define HEX2_198 c6
+#define HEX2_199 c7
+#define HEX2_200 c8
+#define HEX2_201 c9
+#define HEX2_202 ca
+#define HEX2_203 cb
+#define HEX2_204 cc
+#define HEX2_205 cd
+#define HEX2_206 ce
+#define HEX2_207 cf
+#define HEX2_208 d0
+#define HEX2_209 d1
+#define HEX2_210 d2
+#define HEX2_211 d3
+#define HEX2_212 d4
+#define HEX2_213 d5
+#define HEX2_214 d6
+#define HEX2_215 d7
+#define HEX2_216 d8
+#define HEX2_217 d9
+#define HEX2_218 da
+#define HEX2_219 db
+#define HEX2_220 dc
+#define HEX2_221 dd
+#define HEX2_222 de
+#define HEX2_223 df
+#define HEX2_224 e0
+#define HEX2_225 e1
+#define HEX2_226 e2
+#define HEX2_227 e3
+#define HEX2_228 e4
+#define HEX2_229 e5
+#define HEX2_230 e6
+#define HEX2_231 e7
+#define HEX2_232 e8
+#define HEX2_233 e9
+#define HEX2_234 ea
+#define HEX2_235 eb
+#define HEX2_236 ec
+#define HEX2_237 ed
+#define HEX2_238 ee
+#define HEX2_239 ef
+#define HEX2_240 f0
+#define HEX2_241 f1
+#define HEX2_242 f2
+#define HEX2_243 f3
+#define HEX2_244 f4
+#define HEX2_245 f5
+#define HEX2_246 f6
+#define HEX2_247 f7
+#define HEX2_248 f8
+#define HEX2_249 f9
+#define HEX2_250 fa
+#define HEX2_251 fb
+#define HEX2_252 fc
+#define HEX2_253 fd
+#define HEX2_254 fe
+#define HEX2_255 ff
@@ -0,0 +1,63 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Measure the per-include parse cost of IREPEAT.hpp against its subset
+IREPEATx100.hpp, as preprocessing time of repeated include/undef pairs.
+
+  pp_include.py <irepeat include dir> <GCC style compiler command...>
+
+Each header is included and #undef'd by its _UNDEF.hpp, INCLUDES times,
+each time followed by one XREPEAT((1)(0),...) so the macros are used.
+The baseline with no includes is subtracted to give the cost per include.
+"""
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+INCLUDES = 1000
+
+HEADERS = [('IREPEAT.hpp', 'IREPEAT_UNDEF.hpp'),
+           ('IREPEATx100.hpp', 'IREPEATx100_UNDEF.hpp')]
+
+USE = 'int a%d[]{XREPEAT((1)(0),HEXLIT,COMMA)};\n'
+
+
+def run(cmd):
+    """Run cmd, return wall seconds, best of 3."""
+    best = None
+    for _ in range(3):
+        start = time.perf_counter()
+        subprocess.run(cmd, stdout=subprocess.DEVNULL, check=True)
+        secs = time.perf_counter() - start
+        best = secs if best is None else min(best, secs)
+    return best
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+
+    with tempfile.TemporaryDirectory() as tmp:
+        def preprocess(lines):
+            src = os.path.join(tmp, 'pp_include.cpp')
+            with open(src, 'w') as out:
+                out.writelines(lines)
+            return run(cxx + ['-E', '-P', '-I' + incdir, src])
+
+        base = preprocess([])
+        print('%-16s %10s %12s' % ('header', 'time (s)', 'us/include'))
+        for header, undef in HEADERS:
+            secs = preprocess(
+                ['#include "%s"\n' % header + USE % i
+                 + '#include "%s"\n' % undef for i in range(INCLUDES)])
+            print('%-16s %10.3f %12.1f'
+                  % (header, secs, (secs - base) / INCLUDES * 1e6))
+            sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
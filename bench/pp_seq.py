@@ -0,0 +1,97 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Compare preprocessing time and peak memory of SEQ_FOR_EACH_I against
+BOOST_PP_SEQ_FOR_EACH_I, for sequences of 16 to 65536 field names,
+with IREPEAT of the same count as a baseline, generating names
+f0x0, f0x1, ... from the index alone.
+
+  pp_seq.py <irepeat include dir> <GCC style compiler command...>
+
+Each method preprocesses, with -E, a struct of one int member per
+element of the sequence (f0)(f1)..., initialized to its index.
+Boost is skipped if not found, and above its sequence limit of 256.
+"""
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+SIZES = [16, 256, 4096, 65536]
+
+BOOST_LIMIT = 256
+
+SRC = {
+    'SEQ_FOR_EACH_I': '''#include "IREPEAT.hpp"
+#include "SEQ_FOR_EACH.hpp"
+#define FIELD(H,E) int E = HEXLIT(H);
+struct fields {SEQ_FOR_EACH_I(FIELDS,FIELD,NOSEP)};
+''',
+    'BOOST_SEQ_FOR_EACH_I': '''#include <boost/preprocessor/seq/for_each_i.hpp>
+#define FIELD(r,d,i,E) int E = i;
+struct fields {BOOST_PP_SEQ_FOR_EACH_I(FIELD,~,FIELDS)};
+''',
+    'IREPEAT': '''#include "IREPEAT.hpp"
+#define FIELD(H) int CAT(f,HEXLIT(H)) = HEXLIT(H);
+struct fields {IREPEAT(COUNT,FIELD,NOSEP)};
+''',
+}
+
+
+def run(cmd):
+    """Run cmd, return (wall seconds, peak RSS in MB) of the child;
+    RSS is nan without os.wait4, as on Windows."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL)
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(proc.pid, 0)
+        mb = usage.ru_maxrss / 1024
+    else:
+        status, mb = proc.wait(), float('nan')
+    secs = time.perf_counter() - start
+    if status != 0:
+        return None
+    return secs, mb
+
+
+def hexs(n):
+    """n as HEXS digits, e.g. 255 -> (f)(f)."""
+    return ''.join('(%s)' % d for d in '%x' % n)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+
+    with tempfile.TemporaryDirectory() as tmp:
+        def preprocess(method, n):
+            src = os.path.join(tmp, 'pp_seq.cpp')
+            with open(src, 'w') as out:
+                out.write('#define FIELDS %s\n#define COUNT %s\n'
+                          % (''.join('(f%d)' % i for i in range(n)),
+                             hexs(n - 1)))
+                out.write(SRC[method])
+            return run(cxx + ['-E', '-P', '-I' + incdir, src])
+
+        boost = preprocess('BOOST_SEQ_FOR_EACH_I', 1) is not None
+
+        print('%-22s %8s %10s %10s'
+              % ('method', 'elements', 'time (s)', 'RSS (MB)'))
+        for n in SIZES:
+            for method in SRC:
+                if method.startswith('BOOST') and (not boost
+                                                   or n > BOOST_LIMIT):
+                    continue
+                result = preprocess(method, n)
+                if result is None:
+                    sys.exit('failed: %s %d' % (method, n))
+                print('%-22s %8d %10.2f %10.0f' % ((method, n) + result))
+                sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
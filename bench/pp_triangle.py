@@ -0,0 +1,85 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Compare compile time and peak memory of a triangle of arrays, row H
+holding elements 0 to H, generated by TRIANGLE against a nested repeat,
+VREPEAT of rows each an IREPEAT, for 16 to 1024 rows.
+
+  pp_triangle.py <irepeat include dir> <GCC style compiler command...>
+
+Each method compiles, with -fsyntax-only, one int array per row,
+t_0 = {0x0}, t_1 = {0x0, 0x1}, ..., so the output is the same,
+quadratic in the row count, and the difference is the expansion.
+"""
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+SIZES = [16, 256, 1024]
+
+SRC = {
+    'TRIANGLE': '''#include "IREPEAT.hpp"
+#include "TRIANGLE.hpp"
+#define ROW(H,...) int CAT(t_,SEQCAT(H))[] = {__VA_ARGS__};
+TRIANGLE(COUNT,HEXLIT,COMMA,ROW,NOSEP)
+''',
+    'VREPEAT of IREPEAT': '''#include "IREPEAT.hpp"
+#define ROW(H) int CAT(t_,SEQCAT(H))[] = {IREPEAT(H,HEXLIT,COMMA)};
+#define VREPEAT_COUNT COUNT
+#define VREPEAT_MACRO ROW
+#include "VREPEAT.hpp"
+''',
+}
+
+
+def run(cmd):
+    """Run cmd, return (wall seconds, peak RSS in MB) of the child;
+    RSS is nan without os.wait4, as on Windows."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL,
+                            stderr=subprocess.DEVNULL)
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(proc.pid, 0)
+        mb = usage.ru_maxrss / 1024
+    else:
+        status, mb = proc.wait(), float('nan')
+    secs = time.perf_counter() - start
+    if status != 0:
+        return None
+    return secs, mb
+
+
+def hexs(n):
+    """n as HEXS digits, e.g. 255 -> (f)(f)."""
+    return ''.join('(%s)' % d for d in '%x' % n)
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+
+    with tempfile.TemporaryDirectory() as tmp:
+        def compile(method, n):
+            src = os.path.join(tmp, 'pp_triangle.cpp')
+            with open(src, 'w') as out:
+                out.write('#define COUNT %s\n' % hexs(n - 1))
+                out.write(SRC[method])
+            return run(cxx + ['-fsyntax-only', '-I' + incdir, src])
+
+        print('%-20s %8s %10s %10s'
+              % ('method', 'rows', 'time (s)', 'RSS (MB)'))
+        for n in SIZES:
+            for method in SRC:
+                result = compile(method, n)
+                if result is None:
+                    sys.exit('failed: %s %d' % (method, n))
+                print('%-20s %8d %10.2f %10.0f' % ((method, n) + result))
+                sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,75 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Measure the per-index preprocessing cost of the generic index macros
+HEXLIT, SEQCAT, x0D and xD against their exact width variants selected
+by LENCAT, e.g. HEXLIT4, in an IREPEAT of 65536 indices.
+
+  pp_width.py <irepeat include dir> <GCC style compiler command...>
+
+Each run preprocesses one IREPEAT((f)(f)(f)(f),M,COMMA) with -E.
+The baseline M(H) that expands to nothing is subtracted to give
+the cost of the index macro alone, per index.
+"""
+import os
+import subprocess
+import sys
+import tempfile
+import time
+
+COUNT = '(f)(f)(f)(f)'
+REPS = 0x10000
+
+MACROS = ['HEXLIT', 'SEQCAT', 'x0D', 'xD']
+
+SRC = '''#include "IREPEAT.hpp"
+#define NONE(H)
+int a[]{IREPEAT(%s,%s,COMMA)};
+'''
+
+
+def run(cmd):
+    """Run cmd, return (wall seconds, peak RSS in MB) of the child;
+    RSS is nan without os.wait4, as on Windows."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(proc.pid, 0)
+        mb = usage.ru_maxrss / 1024
+    else:
+        status, mb = proc.wait(), float('nan')
+    secs = time.perf_counter() - start
+    if status != 0:
+        sys.exit('failed: ' + ' '.join(cmd))
+    return secs, mb
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+
+    with tempfile.TemporaryDirectory() as tmp:
+        def preprocess(m):
+            src = os.path.join(tmp, 'pp_width.cpp')
+            with open(src, 'w') as out:
+                out.write(SRC % (COUNT, m))
+            return min(run(cxx + ['-E', '-P', '-I' + incdir, src])
+                       for _ in range(3))
+
+        base, _ = preprocess('NONE')
+        print('%-24s %10s %10s %10s'
+              % ('M', 'time (s)', 'RSS (MB)', 'ns/index'))
+        for macro in MACROS:
+            for name, m in [(macro, macro),
+                            ('LENCAT(%s,N)' % macro,
+                             'LENCAT(%s,%s)' % (macro, COUNT))]:
+                secs, mb = preprocess(m)
+                print('%-24s %10.2f %10.0f %10.0f'
+                      % (name, secs, mb, (secs - base) / REPS * 1e9))
+                sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
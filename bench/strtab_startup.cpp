@@ -0,0 +1,40 @@
+#if 0
+ SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+ SPDX-License-Identifier: BSL-1.0
+
+ Startup benchmark source, compiled by strtab_startup.py.
+ Defines a table of COUNT names "x0000" to "xffff", HEXS digits,
+ as one of, selected by -D:
+
+   BENCH_STRTAB    STRTAB, one blob indexed by offsets
+   BENCH_POINTERS  array of const char*, one pointer per name
+
+ and prints the name indexed by the argument count, so that
+ the table is kept and read once.
+#endif
+
+#include "IREPEAT.hpp"
+
+#include <cstdio>
+
+#define NAME(H) STR(LENCAT(x0D,COUNT)(H))
+
+#if defined(BENCH_STRTAB)
+
+#include "STRTAB.hpp"
+
+STRTAB(names,COUNT,NAME)
+
+int main(int argc, char**) { std::puts(names::c_str(argc)); }
+
+#elif defined(BENCH_POINTERS)
+
+char const* const names[] {XREPEAT(COUNT,NAME,COMMA)};
+
+int main(int argc, char**) { std::puts(names[argc]); }
+
+#endif
+
+#undef NAME
+
+#include "IREPEAT_UNDEF.hpp"
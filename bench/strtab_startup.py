@@ -0,0 +1,84 @@
+#!/usr/bin/env python3
+# SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+# SPDX-License-Identifier: BSL-1.0
+"""
+Compare STRTAB.hpp against an array of const char* for 4096 and
+65535 names: compile time and peak memory, relative relocations
+in the position independent executable, and startup time.
+
+  strtab_startup.py <irepeat include dir> <GCC style compiler command...>
+
+Each method compiles strtab_startup.cpp with -O2 -fPIE -pie,
+see the comment in that file. Relocations are counted by readelf,
+if found. Startup time is the mean wall time of RUNS runs.
+"""
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+METHODS = ['STRTAB', 'POINTERS']
+
+# (names, COUNT as HEXS)
+SIZES = [(4096, '(1)(0)(0)(0)'),
+         (65535, '(f)(f)(f)(f)')]
+
+RUNS = 200
+
+
+def run(cmd):
+    """Run cmd, return (wall seconds, peak RSS in MB) of the child;
+    RSS is nan without os.wait4, as on Windows."""
+    start = time.perf_counter()
+    proc = subprocess.Popen(cmd, stdout=subprocess.DEVNULL)
+    if hasattr(os, 'wait4'):
+        _, status, usage = os.wait4(proc.pid, 0)
+        mb = usage.ru_maxrss / 1024
+    else:
+        status, mb = proc.wait(), float('nan')
+    secs = time.perf_counter() - start
+    if status != 0:
+        sys.exit('failed: ' + ' '.join(cmd))
+    return secs, mb
+
+
+def relocations(exe):
+    """Count R_*_RELATIVE relocations in exe, or None without readelf."""
+    if not shutil.which('readelf'):
+        return None
+    out = subprocess.run(['readelf', '-rW', exe], check=True,
+                         stdout=subprocess.PIPE, text=True).stdout
+    return sum('RELATIVE' in line for line in out.splitlines())
+
+
+def main():
+    if len(sys.argv) < 3:
+        sys.exit(__doc__)
+    incdir, cxx = sys.argv[1], sys.argv[2:]
+    srcdir = os.path.dirname(os.path.abspath(__file__))
+    src = os.path.join(srcdir, 'strtab_startup.cpp')
+
+    print('%-9s %6s %10s %10s %8s %12s'
+          % ('method', 'names', 'time (s)', 'RSS (MB)',
+             'relocs', 'startup (us)'))
+    with tempfile.TemporaryDirectory() as tmp:
+        for names, count in SIZES:
+            for method in METHODS:
+                exe = os.path.join(tmp, method + str(names))
+                secs, mb = run(cxx + ['-O2', '-std=c++17', '-fPIE', '-pie',
+                                      '-o', exe, '-I' + incdir,
+                                      '-DBENCH_' + method,
+                                      '-DCOUNT=' + count, src])
+                relocs = relocations(exe)
+                run([exe])
+                startup = sum(run([exe])[0] for _ in range(RUNS)) / RUNS
+                print('%-9s %6d %10.2f %10.0f %8s %12.0f'
+                      % (method, names, secs, mb,
+                         '-' if relocs is None else relocs, startup * 1e6))
+                sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
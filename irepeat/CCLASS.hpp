@@ -0,0 +1,88 @@
+#ifndef CCLASS_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define CCLASS_HPP // including the CCLASS_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  CCLASS(NAME,N,P) : Define struct NAME, a bit-packed table of
+                     N character class properties of each byte
+
+    NAME: name of the generated struct
+    N: count of properties as HEXS digits, (1) to (1)(0), 1 to 16
+    P: property macro; P(H) is the H'th property as (name,PRED),
+       PRED(C) a predicate macro true if byte code C has the property
+
+  The generated struct has, for each property (name,PRED), bit H
+
+    NAME::type        : std::uint8_t for up to 8 properties, else 16 bit
+    NAME::bit::name   : the bit index H, an unscoped enumerator
+    NAME::name        : the mask 1 << H, static constexpr type
+
+  and a table of 256 entries of type, one per byte, of all properties
+
+    NAME::table()     : the table, generated by IREPEAT((f)(f),...)
+    NAME::bits(c)     : table entry of char c, its property bits
+    NAME::is(c,m)     : true if c has any property of mask m
+    NAME::classify(c) : constexpr, the property bits of byte code c
+                        evaluated from the predicates, as per entry
+
+  so a lexer loads one entry per byte for any test of its properties,
+  e.g. NAME::is(c, NAME::alpha | NAME::digit), in place of a table per
+  property. Property names must not clash with these member names.
+  Depends on prior inclusion of IREPEAT.hpp.
+
+  Predicates for ASCII classes, the "C" locale <cctype> classes:
+
+    CCLASS_DIGIT, CCLASS_XDIGIT, CCLASS_UPPER, CCLASS_LOWER,
+    CCLASS_ALPHA, CCLASS_ALNUM, CCLASS_SPACE, CCLASS_PUNCT,
+    CCLASS_IDSTART, alpha or _, CCLASS_IDCONT, alnum or _
+*/
+#endif
+
+#include <cstdint>
+#include <type_traits>
+
+#define CCLASS(NAME,N,P) struct NAME {\
+static_assert(HEXLIT(N) >= 1 && HEXLIT(N) <= 16,\
+"CCLASS: 1 to 16 properties");\
+using type = std::conditional<(HEXLIT(N) <= 8),\
+std::uint8_t, std::uint16_t>::type;\
+struct bit { enum : unsigned { CCLASS_EVAL(XREPEAT(N,CCLASS_BIT P,COMMA)) }; };\
+CCLASS_EVAL(XREPEAT(N,CCLASS_MASK P,NOSEP))\
+static constexpr type classify(unsigned cclass_c) {\
+return static_cast<type>(0u CCLASS_EVAL(XREPEAT(N,CCLASS_TEST P,NOSEP))); }\
+static type const* table() {\
+static constexpr type cclass_t[] {IREPEAT((f)(f),CCLASS_ENTRY,COMMA)};\
+return cclass_t; }\
+static type bits(char cclass_c)\
+{ return table()[static_cast<unsigned char>(cclass_c)]; }\
+static bool is(char cclass_c, unsigned cclass_m)\
+{ return (bits(cclass_c) & cclass_m) != 0; } };
+
+// CCLASS_EVAL(...): rescan XREPEAT(N,CCLASS_X P,S) -> CCLASS_X (name,PRED) ...
+#define CCLASS_EVAL(...) __VA_ARGS__
+
+#define CCLASS_BIT(NAME,PRED) NAME
+#define CCLASS_MASK(NAME,PRED) static constexpr type NAME\
+ = static_cast<type>(1u << bit::NAME);
+#define CCLASS_TEST(NAME,PRED) | (PRED(cclass_c) ? 1u << bit::NAME : 0u)
+
+// CCLASS_ENTRY(H): the table entry of byte code H, evaluated at compile time
+#define CCLASS_ENTRY(H) classify(HEXLIT(H))
+
+#define CCLASS_DIGIT(C) ((C) >= '0' && (C) <= '9')
+#define CCLASS_UPPER(C) ((C) >= 'A' && (C) <= 'Z')
+#define CCLASS_LOWER(C) ((C) >= 'a' && (C) <= 'z')
+#define CCLASS_ALPHA(C) (CCLASS_UPPER(C) || CCLASS_LOWER(C))
+#define CCLASS_ALNUM(C) (CCLASS_ALPHA(C) || CCLASS_DIGIT(C))
+#define CCLASS_XDIGIT(C) (CCLASS_DIGIT(C) || ((C) >= 'a' && (C) <= 'f')\
+                                         || ((C) >= 'A' && (C) <= 'F'))
+#define CCLASS_SPACE(C) ((C) == ' ' || ((C) >= '\t' && (C) <= '\r'))
+#define CCLASS_PUNCT(C) ((C) > ' ' && (C) < 0x7f && !CCLASS_ALNUM(C))
+#define CCLASS_IDSTART(C) (CCLASS_ALPHA(C) || (C) == '_')
+#define CCLASS_IDCONT(C) (CCLASS_ALNUM(C) || (C) == '_')
+
+#endif
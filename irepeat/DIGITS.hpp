@@ -0,0 +1,154 @@
+#ifndef DIGITS_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define DIGITS_HPP // including the DIGITS_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  DIGITS(NAME) : Define struct NAME of integer formatting and parsing
+
+    NAME: name of the generated struct
+
+  The generated struct has lookup tables, as static member functions
+
+    NAME::dec_pairs() : "00" "01" ... "99", 200 chars
+    NAME::hex_pairs() : "00" "01" ... "ff", 512 chars and a null
+    NAME::values()    : 256 digit values by char, 0-9, a-f and A-F,
+                        else 0xff
+
+  and encode and decode routines for unsigned integer types of up to
+  64 bits, e.g. std::uint32_t and std::uint64_t
+
+    NAME::dec_length(v) : count of decimal digits of v, 1 to 20
+    NAME::hex_length(v) : count of hex digits of v, 1 to 16
+    NAME::to_dec(p,v)   : write v in decimal at p, return the end
+    NAME::to_hex(p,v)   : write v in lowercase hex at p, return the end
+    NAME::from_dec(first,last,v) : parse decimal digits to v
+    NAME::from_hex(first,last,v) : parse hex digits, either case, to v
+
+  As std::to_chars, to_dec and to_hex write no sign, prefix or null;
+  the buffer must hold dec_length(v) or hex_length(v) chars.
+  As std::from_chars, from_dec and from_hex parse the longest prefix
+  of digits, leading zeros included, and return the end of it; with
+  no digits, or a value out of range of v, they return nullptr and
+  leave v unchanged. Depends on prior inclusion of IREPEAT.hpp.
+
+  The tables are generated by IREPEAT, in place of hand-kept tables.
+  Lengths are from the bit width by builtin, with GCC and Clang, else
+  sums of compares, KRANK style, both with no branch; encoding
+  writes two digits per step, from the end, by pair table lookup.
+  Decoding accumulates the digits that can't overflow with no checks,
+  then checks any one digit more; hex digits are valued by table.
+*/
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <type_traits>
+
+#define DIGITS(NAME) struct NAME {\
+static char const* dec_pairs() {\
+static constexpr char digits_t[] {IREPEAT((6)(3),DIGITS_DEC,COMMA)};\
+return digits_t; }\
+static char const* hex_pairs() {\
+static constexpr char digits_t[] = IREPEAT((f)(f),DIGITS_HEX,NOSEP);\
+return digits_t; }\
+static unsigned char const* values() {\
+static constexpr unsigned char digits_t[] {IREPEAT((f)(f),DIGITS_VAL,COMMA)};\
+return digits_t; }\
+static constexpr std::uint64_t pow10(unsigned digits_n)\
+{ return digits_n == 0 ? 1 : 10 * pow10(digits_n - 1); }\
+template <typename U> static unsigned dec_length(U digits_v) {\
+DIGITS_CHECK(U); DIGITS_DEC_LENGTH }\
+template <typename U> static unsigned hex_length(U digits_v) {\
+DIGITS_CHECK(U); DIGITS_HEX_LENGTH }\
+template <typename U> static char* to_dec(char* digits_p, U digits_v) {\
+char* digits_e = digits_p += dec_length(digits_v);\
+for (; digits_v >= 100; digits_v /= 100)\
+std::memcpy(digits_p -= 2, dec_pairs() + digits_v % 100 * 2, 2);\
+if (digits_v >= 10) std::memcpy(digits_p - 2, dec_pairs() + digits_v * 2, 2);\
+else digits_p[-1] = static_cast<char>('0' + digits_v);\
+return digits_e; }\
+template <typename U> static char* to_hex(char* digits_p, U digits_v) {\
+char* digits_e = digits_p += hex_length(digits_v);\
+for (; digits_v >= 0x100; digits_v >>= 8)\
+std::memcpy(digits_p -= 2, hex_pairs() + (digits_v & 0xff) * 2, 2);\
+if (digits_v >= 0x10) std::memcpy(digits_p - 2, hex_pairs() + digits_v * 2, 2);\
+else digits_p[-1] = hex_pairs()[digits_v * 2 + 1];\
+return digits_e; }\
+template <typename U> static char const* from_dec(\
+char const* digits_first, char const* digits_last, U& digits_v) {\
+DIGITS_PARSE(10, std::numeric_limits<U>::digits10, DIGITS_DEC_AT)\
+if (digits_p != digits_last && (digits_d = DIGITS_DEC_AT) < 10) {\
+if (digits_r > (static_cast<U>(-1) - digits_d) / 10) return nullptr;\
+digits_r = static_cast<U>(digits_r * 10 + digits_d);\
+if (++digits_p != digits_last && DIGITS_DEC_AT < 10) return nullptr; }\
+digits_v = digits_r; return digits_p; }\
+template <typename U> static char const* from_hex(\
+char const* digits_first, char const* digits_last, U& digits_v) {\
+unsigned char const* digits_t = values();\
+DIGITS_PARSE(16, sizeof(U) * 2, DIGITS_HEX_AT)\
+if (digits_p != digits_last && DIGITS_HEX_AT < 16) return nullptr;\
+digits_v = digits_r; return digits_p; } };
+
+// DIGITS_DEC(H): the decimal digit pair of H, 0 to 99, as two chars
+#define DIGITS_DEC(H) '0' + HEXLIT2(H) / 10, '0' + HEXLIT2(H) % 10
+
+// DIGITS_HEX(H): the hex digit pair of H, 0 to ff, as a string literal
+#define DIGITS_HEX(H) STR(SEQCAT2(H))
+
+// DIGITS_VAL(H): the digit value of char code H, or 0xff
+#define DIGITS_VAL(H) DIGITS_VALUE(HEXLIT2(H))
+#define DIGITS_VALUE(C) (C >= '0' && C <= '9' ? C - '0'\
+                      : C >= 'a' && C <= 'f' ? C - 'a' + 10\
+                      : C >= 'A' && C <= 'F' ? C - 'A' + 10 : 0xff)
+
+#define DIGITS_CHECK(U) static_assert(std::is_unsigned<U>::value\
+&& sizeof(U) <= 8, "DIGITS: unsigned integer type of up to 64 bits")
+
+// Lengths from the bit width of v, 1 to 64, where there's a builtin;
+// decimal as log10(2) * bits, less one if under that power of ten
+#if defined(__GNUC__)
+#define DIGITS_BITS (64 - __builtin_clzll(DIGITS_V1))
+#define DIGITS_DEC_LENGTH static constexpr std::uint64_t digits_t[]\
+{XREPEAT((1)(4),DIGITS_POW10,COMMA)};\
+unsigned digits_n = DIGITS_BITS * 1233 >> 12;\
+return digits_n + 1 - (DIGITS_V1 < digits_t[digits_n]);
+#define DIGITS_HEX_LENGTH return (DIGITS_BITS + 3) / 4;
+#else
+#define DIGITS_DEC_LENGTH return 1 XREPEAT((1)(3),DIGITS_GE,NOSEP);
+#define DIGITS_HEX_LENGTH return 1 XREPEAT((f),DIGITS_NZ,NOSEP);
+#endif
+
+#define DIGITS_POW10(H) pow10(HEXLIT(H))
+#define DIGITS_V1 (std::uint64_t(digits_v) | 1)
+
+// Compares as 64-bit, constant folded to false beyond the width of U
+#define DIGITS_GE(H) + (std::uint64_t(digits_v) >= pow10(HEXLIT(H) + 1))
+#define DIGITS_NZ(H) + ((std::uint64_t(digits_v) >> (HEXLIT(H) * 4 + 4)) != 0)
+
+// The value of the digit at digits_p, or 10 or more if not a digit;
+// decimal by subtraction, hex by the values table
+#define DIGITS_DEC_AT static_cast<unsigned>(*digits_p - '0')
+#define DIGITS_HEX_AT digits_t[static_cast<unsigned char>(*digits_p)]
+
+// DIGITS_PARSE(B,S,D): skip leading zeros, then accumulate up to S
+//                      base B digits D into digits_r, which can't overflow
+#define DIGITS_PARSE(B,S,D) DIGITS_CHECK(U);\
+char const* digits_p = digits_first;\
+while (digits_p != digits_last && *digits_p == '0') ++digits_p;\
+bool digits_any = digits_p != digits_first;\
+char const* digits_s =\
+digits_last - digits_p > static_cast<std::ptrdiff_t>(S) ? digits_p + S\
+                                                        : digits_last;\
+U digits_r = 0;\
+unsigned digits_d;\
+for (; digits_p != digits_s && (digits_d = D) < B;\
+++digits_p) digits_r = static_cast<U>(digits_r * B + digits_d);\
+if (!digits_any && digits_p == digits_first) return nullptr;
+
+#endif
@@ -0,0 +1,180 @@
+#ifndef DISPATCH_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define DISPATCH_HPP // including the DISPATCH_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  DISPATCH(NAME,N,F)      : Define struct NAME, runtime n to F<n>(a...)
+  DISPATCH2(NAME,N1,N2,F) : Define struct NAME, runtime i,j to F<i,j>(a...)
+
+    NAME: name of the generated struct
+    N, N1, N2: count of indices as HEXS digits, e.g. (1)(0)(0) == 256,
+               of 1 to 4 digits, so at most (f)(f)(f)(f) == 0xffff
+    F: function template name, called with unsigned template arguments
+
+  The generated struct has static member function templates
+
+    NAME::call(n, a...) : switch on n, case k: return F<k>(a...);
+    NAME::jump(n, a...) : index a table of pointers &F<k> by n
+
+  and DISPATCH2 has call(i, j, a...) and jump(i, j, a...), dispatching
+  on i to a row of N2 then on j, through one forwarding call per F<i,j>.
+  The return type is that of F<0>(a...), or F<0,0>(a...) for DISPATCH2;
+  the jump table requires the same signature of all F<k>.
+  A count of more than 4 digits fails a static_assert, as IREPEAT
+  has at most 4. Depends on prior inclusion of IREPEAT.hpp.
+
+  Indices must be less than their count; call dispatches others
+  to F<0> while jump has undefined behavior. Each F<k> is named
+  directly in the expansion, with no index_sequence pack expansion.
+
+  #define DISPATCH_HITS before #include "DISPATCH.hpp" to count calls:
+
+    NAME::hits()  : the array of N counts of calls of each F<k>
+    NAME::dump(f) : print the hit counts to FILE* f, hottest first
+
+  for reordering cases or splitting out hot ones. DISPATCH2 counts
+  per row in NAME::hits() and per F<i,j> in NAME::row<i>::hits().
+  The counts are not atomic. Without DISPATCH_HITS there is no count.
+*/
+#endif
+
+#define DISPATCH(NAME,N,F) struct NAME { DISPATCH_CHECK(N)\
+DISPATCH_HITS_OF(NAME,N,-1)\
+template <typename... A>\
+static auto call(unsigned dispatch_n, A&&... dispatch_a)\
+-> decltype(F<0>(DISPATCH_ARGS)) {\
+switch (dispatch_n) { default: IREPEAT(DISPATCH_DEC(N),DISPATCH_CASE,\
+DISPATCH_HIT(dispatch_k) return F<dispatch_k>(DISPATCH_ARGS); } EAT)\
+DISPATCH_HIT(dispatch_k) return F<dispatch_k>(DISPATCH_ARGS); } } }\
+template <typename... A>\
+static auto jump(unsigned dispatch_n, A&&... dispatch_a)\
+-> decltype(F<0>(DISPATCH_ARGS)) {\
+static constexpr decltype(&F<0>) dispatch_table[]\
+{IREPEAT(DISPATCH_DEC(N),&F<HEXLIT,DISPATCH_PTR_SEP)>};\
+DISPATCH_HIT(dispatch_n) return dispatch_table[dispatch_n](DISPATCH_ARGS); } };
+
+// Rows of F<i,k> forward through at<k> as F<i,k> has a comma,
+// so can't be passed to IREPEAT in the separator or macro tokens
+#define DISPATCH2(NAME,N1,N2,F) struct NAME {\
+DISPATCH_CHECK(N1) DISPATCH_CHECK(N2)\
+template <unsigned dispatch_i> struct row { DISPATCH_HITS_OF(NAME,N2,dispatch_i)\
+template <unsigned dispatch_k, typename... A>\
+static auto at(A&&... dispatch_a)\
+-> decltype(F<dispatch_i,dispatch_k>(DISPATCH_ARGS))\
+{ return F<dispatch_i,dispatch_k>(DISPATCH_ARGS); }\
+template <typename... A>\
+static auto call(unsigned dispatch_n, A&&... dispatch_a)\
+-> decltype(at<0>(DISPATCH_ARGS)) {\
+switch (dispatch_n) { default: IREPEAT(DISPATCH_DEC(N2),DISPATCH_CASE,\
+DISPATCH_HIT(dispatch_k) return at<dispatch_k>(DISPATCH_ARGS); } EAT)\
+DISPATCH_HIT(dispatch_k) return at<dispatch_k>(DISPATCH_ARGS); } } }\
+template <typename... A>\
+static auto jump(unsigned dispatch_n, A&&... dispatch_a)\
+-> decltype(at<0>(DISPATCH_ARGS)) {\
+static constexpr decltype(at<0>(DISPATCH_ARGS)) (*dispatch_table[])(A&&...)\
+{IREPEAT(DISPATCH_DEC(N2),&at<HEXLIT,DISPATCH_AT_SEP)DISPATCH_AT_SEP_};\
+DISPATCH_HIT(dispatch_n) return dispatch_table[dispatch_n](DISPATCH_ARGS); } };\
+template <typename... A>\
+static auto call(unsigned dispatch_n, A&&... dispatch_a)\
+-> decltype(row<0>::call(DISPATCH_ARGS)) {\
+switch (dispatch_n) { default: IREPEAT(DISPATCH_DEC(N1),DISPATCH_CASE,\
+DISPATCH_HIT(dispatch_k) return row<dispatch_k>::call(DISPATCH_ARGS); } EAT)\
+DISPATCH_HIT(dispatch_k) return row<dispatch_k>::call(DISPATCH_ARGS); } } }\
+template <typename... A>\
+static auto jump(unsigned dispatch_n, unsigned dispatch_j, A&&... dispatch_a)\
+-> decltype(row<0>::jump(dispatch_j,DISPATCH_ARGS)) {\
+static constexpr decltype(row<0>::jump(dispatch_j,DISPATCH_ARGS))\
+(*dispatch_table[])(unsigned, A&&...)\
+{IREPEAT(DISPATCH_DEC(N1),&row<HEXLIT,DISPATCH_ROW_SEP)DISPATCH_ROW_SEP_};\
+DISPATCH_HIT(dispatch_n) return dispatch_table[dispatch_n](dispatch_j,DISPATCH_ARGS); }\
+DISPATCH_HITS_OF2(NAME,N1) };
+
+#define DISPATCH_ARGS static_cast<A&&>(dispatch_a)...
+
+// DISPATCH_FITS(N): 1 if count N has at most 4 digits, else 0, for
+// which DISPATCH_DEC(N) is (0), one case, so only DISPATCH_CHECK fails
+#define DISPATCH_FITS(N) ARG1(CAT(DISPATCH_FITS_,LEN(N)),0,)
+#define DISPATCH_FITS_1 ,1
+#define DISPATCH_FITS_2 ,1
+#define DISPATCH_FITS_3 ,1
+#define DISPATCH_FITS_4 ,1
+#define DISPATCH_DEC(N) CAT(DISPATCH_DEC_,DISPATCH_FITS(N))(N)
+#define DISPATCH_DEC_1(N) DEC(N)
+#define DISPATCH_DEC_0(N) (0)
+#define DISPATCH_CHECK(N) static_assert(DISPATCH_FITS(N),\
+"DISPATCH: N of at most 4 hex digits, (f)(f)(f)(f)");
+
+// Case k declares dispatch_k = k for the F<dispatch_k> call that follows
+// in the separator, which is the only argument in scope of F
+#define DISPATCH_CASE(H) case HEXLIT(H): {\
+constexpr unsigned dispatch_k = HEXLIT(H);
+
+// Table entry &F<HEXLIT(H) is closed by its separator, or after the last
+#define DISPATCH_PTR_SEP() >,
+#define DISPATCH_AT_SEP() DISPATCH_AT_SEP_,
+#define DISPATCH_AT_SEP_ ,A...>
+#define DISPATCH_ROW_SEP() DISPATCH_ROW_SEP_,
+#define DISPATCH_ROW_SEP_ >::template jump<A...>
+
+#if defined(DISPATCH_HITS)
+
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#define DISPATCH_HIT(K) hits()[K] += 1;
+
+#define DISPATCH_HITS_OF(NAME,N,ROW) DISPATCH_HITS_ARRAY(N)\
+static void dump(std::FILE* dispatch_f = stdout)\
+{ dispatch_dump(dispatch_f, #NAME, ROW, hits(), HEXLIT(N)); }
+
+// DISPATCH2 dump prints the row counts, then each row's counts
+#define DISPATCH_HITS_OF2(NAME,N) DISPATCH_HITS_ARRAY(N)\
+static void dump(std::FILE* dispatch_f = stdout) {\
+dispatch_dump(dispatch_f, #NAME, -1, hits(), HEXLIT(N));\
+IREPEAT(DISPATCH_DEC(N),row<HEXLIT,DISPATCH_DUMP_SEP)DISPATCH_DUMP_SEP_ }
+
+#define DISPATCH_HITS_ARRAY(N)\
+static unsigned long long (&hits())[HEXLIT(N)]\
+{ static unsigned long long dispatch_hits[HEXLIT(N)]; return dispatch_hits; }
+
+#define DISPATCH_DUMP_SEP() DISPATCH_DUMP_SEP_
+#define DISPATCH_DUMP_SEP_ >::dump(dispatch_f);
+
+// dispatch_dump(f,name,row,hits,n): print nonzero hits, hottest first,
+//                                   with the count of cases not hit
+inline void dispatch_dump(std::FILE* f, char const* name, int row,
+                          unsigned long long const* hits, unsigned n)
+{
+  std::vector<unsigned> order;
+  unsigned long long total = 0;
+  for (unsigned k = 0; k != n; ++k)
+    if (hits[k] != 0) {
+      order.push_back(k);
+      total += hits[k];
+    }
+  std::stable_sort(order.begin(), order.end(),
+                   [hits](unsigned a, unsigned b) { return hits[a] > hits[b]; });
+  if (row < 0)
+    std::fprintf(f, "%s hits: %llu", name, total);
+  else
+    std::fprintf(f, "%s row %d hits: %llu", name, row, total);
+  std::fprintf(f, ", %u of %u cases not hit\n",
+               n - static_cast<unsigned>(order.size()), n);
+  for (unsigned k : order)
+    std::fprintf(f, "%8u %14llu %6.2f%%\n", k, hits[k], 100.0 * hits[k] / total);
+}
+
+#else
+
+#define DISPATCH_HIT(K)
+#define DISPATCH_HITS_OF(NAME,N,ROW)
+#define DISPATCH_HITS_OF2(NAME,N)
+
+#endif
+
+#endif
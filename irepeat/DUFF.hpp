@@ -0,0 +1,40 @@
+#ifndef DUFF_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define DUFF_HPP // including the DUFF_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  DUFF(U,N,B) : Duff's device, runs statement B() N times, unrolled U-way
+
+    U: unroll factor as HEXS digits, e.g. (1)(0) == 16
+    N: runtime trip count, evaluated once, non-negative
+    B: statement-generator; B() expands to a complete statement
+
+  Depends on prior inclusion of IREPEAT.hpp. Expands to a statement:
+
+    switch (N % U) { case U-1: B() case U-2: B() ... case 1: B() case 0:; }
+    for (N /= U; N != 0; --N) { B() B() ... B() } // U times
+*/
+#endif
+
+#define DUFF(U,N,B) do {\
+constexpr unsigned long long duff_u = HEXLIT(U);\
+unsigned long long duff_n = (N);\
+switch (duff_n % duff_u) {IREPEAT(DEC(U),DUFF_CASE,B() DUFF_FALLTHROUGH EAT);}\
+for (duff_n /= duff_u; duff_n != 0; --duff_n) {IREPEAT(DEC(U),EAT,B) B()}\
+} while (0)
+
+#define DUFF_CASE(H) case duff_u-1-HEXLIT(H):
+
+#if __cplusplus >= 201703L
+#define DUFF_FALLTHROUGH [[fallthrough]];
+#elif defined(__GNUC__)
+#define DUFF_FALLTHROUGH __attribute__((fallthrough));
+#else
+#define DUFF_FALLTHROUGH
+#endif
+
+#endif
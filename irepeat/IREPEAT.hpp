@@ -1,6 +1,10 @@
 #ifndef IREPEAT_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
 #define IREPEAT_HPP // including the IREPEAT_HPP header guard.
 
+#if defined(IREPEATx100_HPP) // Supersede the IREPEATx100.hpp subset
+#include "IREPEATx100_UNDEF.hpp"
+#endif
+
 #if 0 /*
   SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
   SPDX-License-Identifier: BSL-1.0
@@ -9,6 +13,11 @@
 
   IREPEAT(HEXS,M,S) : Inclusive repeat of M(H) with separator S()
   XREPEAT(HEXS,M,S) : Exclusive repeat of M(H) with separator S()
+  BREPEAT(HEXS,M,S) : Inclusive repeat of M(H,L) per 16-index block
+
+    BREPEAT calls M(H,L) once per block of indices H(0)...H(L)
+    H: high digits HEXS, empty for a single digit HEXS
+    L: last low digit as HEXS, (f) except in a partial final block
 
     HEXS: repeat count as HEXS digits, e.g. (f)(f) == 255
     M: macro / tokens to expand, each with index M(H)
@@ -20,6 +29,8 @@
 
 #define IREPEAT(HEXS,M,S) CAT(REPEAT,LEN(HEXS))(HEXS,S,M)
 
+#define BREPEAT(HEXS,M,S) CAT(BREPEAT,LEN(HEXS))(HEXS,S,M)
+
 #define STR_(A) #A
 #define STR(A) STR_(A)
 
@@ -46,6 +57,8 @@
 #define SEQ1(SQ) SEQ0(EAT SQ())
 #define SEQ2(SQ) SEQ1(EAT SQ())
 #define SEQ3(SQ) SEQ2(EAT SQ())
+#define SEQ4(SQ) SEQ3(EAT SQ())
+#define SEQ5(SQ) SEQ4(EAT SQ())
 #define SEQ(N) CAT(SEQ,N)
 
 #define CSV(SEQ) POSTCAT(_,CSVu SEQ)
@@ -85,6 +98,71 @@ A##B##C##D##E##F##G##H##I##J##K##L##M##N##O##P
 #define HEX(D) CAT(0x,D)
 #define HEXLIT(HEXS) HEX(SEQCAT(HEXS))
 
+// Exact width variants for HEXS of n = 1 to 4 digits, as repeat indices;
+// IREPEAT(N,LENCAT(HEXLIT,N),S) selects HEXLIT4 once for 4-digit N,
+// skipping the CSV and 16-argument VCAT of each generic HEXLIT(H)
+#define LENCAT(NAME,HEXS) CAT(NAME,LEN(HEXS))
+
+#define SEQCAT1(SEQ) PCAT1(,CSV1_ SEQ)
+#define SEQCAT2(SEQ) PCAT2(,CSV2_ SEQ)
+#define SEQCAT3(SEQ) PCAT3(,CSV3_ SEQ)
+#define SEQCAT4(SEQ) PCAT4(,CSV4_ SEQ)
+
+#define RMLZCAT1(HEXS) PCAT1(,CSV1_ HEXS)
+#define RMLZCAT2(HEXS) RMLZV2(,CSV2_ HEXS)
+#define RMLZCAT3(HEXS) RMLZV3(,CSV3_ HEXS)
+#define RMLZCAT4(HEXS) RMLZV4(,CSV4_ HEXS)
+
+#define xD1(HEXS) PCAT1(x,CSV1_ HEXS)
+#define xD2(HEXS) RMLZV2(x,CSV2_ HEXS)
+#define xD3(HEXS) RMLZV3(x,CSV3_ HEXS)
+#define xD4(HEXS) RMLZV4(x,CSV4_ HEXS)
+#define XD1(HEXS) PCAT1(X,CSV1_ HEXS)
+#define XD2(HEXS) RMLZV2(X,CSV2_ HEXS)
+#define XD3(HEXS) RMLZV3(X,CSV3_ HEXS)
+#define XD4(HEXS) RMLZV4(X,CSV4_ HEXS)
+#define x0D1(HEXS) PCAT1(x,CSV1_ HEXS)
+#define x0D2(HEXS) PCAT2(x,CSV2_ HEXS)
+#define x0D3(HEXS) PCAT3(x,CSV3_ HEXS)
+#define x0D4(HEXS) PCAT4(x,CSV4_ HEXS)
+#define X0D1(HEXS) PCAT1(X,CSV1_ HEXS)
+#define X0D2(HEXS) PCAT2(X,CSV2_ HEXS)
+#define X0D3(HEXS) PCAT3(X,CSV3_ HEXS)
+#define X0D4(HEXS) PCAT4(X,CSV4_ HEXS)
+
+#define HEXLIT1(HEXS) PCAT1(0x,CSV1_ HEXS)
+#define HEXLIT2(HEXS) PCAT2(0x,CSV2_ HEXS)
+#define HEXLIT3(HEXS) PCAT3(0x,CSV3_ HEXS)
+#define HEXLIT4(HEXS) PCAT4(0x,CSV4_ HEXS)
+
+// CSVn_ HEXS: the n digits as arguments, A,B,... with no terminal CSVu_
+#define CSV1_(A) A
+#define CSV2_(A) A,CSV1_
+#define CSV3_(A) A,CSV2_
+#define CSV4_(A) A,CSV3_
+
+// PCATn(P,A,...): CAT prefix P, possibly empty, with n digits
+#define PCAT1(...) PCAT1_(__VA_ARGS__)
+#define PCAT1_(P,A) P##A
+#define PCAT2(...) PCAT2_(__VA_ARGS__)
+#define PCAT2_(P,A,B) P##A##B
+#define PCAT3(...) PCAT3_(__VA_ARGS__)
+#define PCAT3_(P,A,B,C) P##A##B##C
+#define PCAT4(...) PCAT4_(__VA_ARGS__)
+#define PCAT4_(P,A,B,C,D) P##A##B##C##D
+
+// RMLZVn(P,A,...): PCATn after dropping leading 0 digits, as RMLZ3
+#define RMLZV_0 ,
+#define RMLZV2(...) RMLZV2_(__VA_ARGS__)
+#define RMLZV2_(P,A,B) ARG1(RMLZV_##A RMLZD2,PCAT2_,)(P,A,B)
+#define RMLZV3(...) RMLZV3_(__VA_ARGS__)
+#define RMLZV3_(P,A,B,C) ARG1(RMLZV_##A RMLZD3,PCAT3_,)(P,A,B,C)
+#define RMLZV4(...) RMLZV4_(__VA_ARGS__)
+#define RMLZV4_(P,A,B,C,D) ARG1(RMLZV_##A RMLZD4,PCAT4_,)(P,A,B,C,D)
+#define RMLZD2(P,A,B) P##B
+#define RMLZD3(P,A,B,C) RMLZV2_(P,B,C)
+#define RMLZD4(P,A,B,C,D) RMLZV3_(P,B,C,D)
+
 #define NOSEP()
 #define COMMA() ,
 #define COLON() ;
@@ -274,4 +352,27 @@ REPEAT2(EAT DDD,S,M PRE(SHEAD(DDD))))
 DOREP4(REPT(X,SHEAD(DDDD),((f)(f)(f),S,M PRE)S,REPEAT3 POST))\
 REPEAT3(EAT DDDD,S,M PRE(SHEAD(DDDD))))
 
+// BREPEAT has its own DOBREP evaluators so that M can use IREPEAT
+
+#define DOBREP1(...) __VA_ARGS__
+#define DOBREP2(...) __VA_ARGS__
+#define DOBREP3(...) __VA_ARGS__
+#define DOBREP4(...) __VA_ARGS__
+
+#define BREPEAT0(D,S,M)
+
+#define BREPEAT1(D,S,M) DOBREP1(M(,D))
+
+#define BREPEAT2(DD,S,M) DOBREP2(\
+DOBREP2(REPT(X,SHEAD(DD),((f),S,M PRE)S,BREPEAT1 POST))\
+BREPEAT1(EAT DD,S,M PRE(SHEAD(DD))))
+
+#define BREPEAT3(DDD,S,M) DOBREP3(\
+DOBREP3(REPT(X,SHEAD(DDD),((f)(f),S,M PRE)S,BREPEAT2 POST))\
+BREPEAT2(EAT DDD,S,M PRE(SHEAD(DDD))))
+
+#define BREPEAT4(DDDD,S,M) DOBREP4(\
+DOBREP4(REPT(X,SHEAD(DDDD),((f)(f)(f),S,M PRE)S,BREPEAT3 POST))\
+BREPEAT3(EAT DDDD,S,M PRE(SHEAD(DDDD))))
+
 #endif
@@ -4,6 +4,7 @@
 
 #undef XREPEAT
 #undef IREPEAT
+#undef BREPEAT
 
 #undef STR_
 #undef STR
@@ -30,6 +31,8 @@
 #undef SEQ1
 #undef SEQ2
 #undef SEQ3
+#undef SEQ4
+#undef SEQ5
 #undef SEQ
 
 #undef CSV
@@ -66,6 +69,65 @@
 #undef HEX
 #undef HEXLIT
 
+#undef LENCAT
+
+#undef SEQCAT1
+#undef SEQCAT2
+#undef SEQCAT3
+#undef SEQCAT4
+
+#undef RMLZCAT1
+#undef RMLZCAT2
+#undef RMLZCAT3
+#undef RMLZCAT4
+
+#undef xD1
+#undef xD2
+#undef xD3
+#undef xD4
+#undef XD1
+#undef XD2
+#undef XD3
+#undef XD4
+#undef x0D1
+#undef x0D2
+#undef x0D3
+#undef x0D4
+#undef X0D1
+#undef X0D2
+#undef X0D3
+#undef X0D4
+
+#undef HEXLIT1
+#undef HEXLIT2
+#undef HEXLIT3
+#undef HEXLIT4
+
+#undef CSV1_
+#undef CSV2_
+#undef CSV3_
+#undef CSV4_
+
+#undef PCAT1
+#undef PCAT1_
+#undef PCAT2
+#undef PCAT2_
+#undef PCAT3
+#undef PCAT3_
+#undef PCAT4
+#undef PCAT4_
+
+#undef RMLZV_0
+#undef RMLZV2
+#undef RMLZV2_
+#undef RMLZV3
+#undef RMLZV3_
+#undef RMLZV4
+#undef RMLZV4_
+#undef RMLZD2
+#undef RMLZD3
+#undef RMLZD4
+
 #undef NOSEP
 #undef COMMA
 #undef COLON
@@ -244,3 +306,281 @@
 #undef REPEAT2
 #undef REPEAT3
 #undef REPEAT4
+
+#undef DOBREP1
+#undef DOBREP2
+#undef DOBREP3
+#undef DOBREP4
+
+#undef BREPEAT0
+#undef BREPEAT1
+#undef BREPEAT2
+#undef BREPEAT3
+#undef BREPEAT4
+
+#undef DUFF_HPP
+#undef DUFF
+#undef DUFF_CASE
+#undef DUFF_FALLTHROUGH
+
+#undef KSEARCH_HPP
+#undef KSEARCH
+#undef KSEARCH_STEP
+#undef KSEARCH_LEN
+#undef KSEARCH_HALF
+#undef KRANK
+#undef KRANK_LT
+
+#undef DISPATCH_HPP
+#undef DISPATCH
+#undef DISPATCH2
+#undef DISPATCH_ARGS
+#undef DISPATCH_FITS
+#undef DISPATCH_FITS_1
+#undef DISPATCH_FITS_2
+#undef DISPATCH_FITS_3
+#undef DISPATCH_FITS_4
+#undef DISPATCH_DEC
+#undef DISPATCH_DEC_1
+#undef DISPATCH_DEC_0
+#undef DISPATCH_CHECK
+#undef DISPATCH_CASE
+#undef DISPATCH_PTR_SEP
+#undef DISPATCH_AT_SEP
+#undef DISPATCH_AT_SEP_
+#undef DISPATCH_ROW_SEP
+#undef DISPATCH_ROW_SEP_
+#undef DISPATCH_HIT
+#undef DISPATCH_HITS_OF
+#undef DISPATCH_HITS_OF2
+#undef DISPATCH_HITS_ARRAY
+#undef DISPATCH_DUMP_SEP
+#undef DISPATCH_DUMP_SEP_
+
+#undef SOA_HPP
+#undef SOA
+#undef SOA_EVAL
+#undef SOA_ARRAY
+#undef SOA_REF
+#undef SOA_CREF
+#undef SOA_AT
+#undef SOA_COPY
+#undef SOA_SWAP
+
+#undef SORTNET_HPP
+#undef SORTNET
+#undef SORTNET_STAGE
+#undef SORTNET_CX
+#undef SORTNET_IS_CX
+
+#undef SHARDS_HPP
+#undef SHARDS
+
+#undef STRTAB_HPP
+#undef STRTAB
+#undef STRTAB_VIEW
+#undef STRTAB_NUL
+#undef STRTAB_EVAL
+#undef STRTAB_END1
+#undef STRTAB_END2
+#undef STRTAB_END3
+#undef STRTAB_END4
+
+#undef PT_HPP
+#undef PT_STATE
+#undef PT_BEGIN
+#undef PT_YIELD
+#undef PT_AWAIT
+#undef PT_RESTART
+#undef PT_EXIT
+#undef PT_END
+#undef PT_YIELD_AT
+#undef PT_AWAIT_AT
+#undef PT_END_AT
+
+#undef SEQ_FOR_EACH_HPP
+#undef SEQ_FOR_EACH_I
+#undef SEQ_FOR_EACH_UP1
+#undef SEQ_FOR_EACH_UP1_1
+#undef SEQ_FOR_EACH_UP1_0
+#undef SEQ_FOR_EACH_UP2
+#undef SEQ_FOR_EACH_UP2_1
+#undef SEQ_FOR_EACH_UP2_0
+#undef SEQ_FOR_EACH_UP3
+#undef SEQ_FOR_EACH_UP3_1
+#undef SEQ_FOR_EACH_UP3_0
+#undef SEQ_FOR_EACH_UP4
+#undef SEQ_FOR_EACH_UP4_1
+#undef SEQ_FOR_EACH_UP4_0
+#undef SEQ_FOR_EACH_ONE
+#undef SEQ_FOR_EACH_O0
+#undef SEQ_FOR_EACH_O1
+#undef SEQ_FOR_EACH_O2
+#undef SEQ_FOR_EACH_O3
+#undef SEQ_FOR_EACH_O0_
+#undef SEQ_FOR_EACH_O1_
+#undef SEQ_FOR_EACH_O2_
+#undef SEQ_FOR_EACH_O3_
+#undef SEQ_FOR_EACH_GROUP
+#undef SEQ_FOR_EACH_LP
+#undef SEQ_FOR_EACH_RP
+#undef SEQ_FOR_EACH_G0
+#undef SEQ_FOR_EACH_G1
+#undef SEQ_FOR_EACH_G2
+#undef SEQ_FOR_EACH_G3
+#undef SEQ_FOR_EACH_G4
+#undef SEQ_FOR_EACH_G5
+#undef SEQ_FOR_EACH_G6
+#undef SEQ_FOR_EACH_G7
+#undef SEQ_FOR_EACH_G8
+#undef SEQ_FOR_EACH_G9
+#undef SEQ_FOR_EACH_Ga
+#undef SEQ_FOR_EACH_Gb
+#undef SEQ_FOR_EACH_Gc
+#undef SEQ_FOR_EACH_Gd
+#undef SEQ_FOR_EACH_Ge
+#undef SEQ_FOR_EACH_Gf
+#undef SEQ_FOR_EACH_G0_
+#undef SEQ_FOR_EACH_G1_
+#undef SEQ_FOR_EACH_G2_
+#undef SEQ_FOR_EACH_G3_
+#undef SEQ_FOR_EACH_G4_
+#undef SEQ_FOR_EACH_G5_
+#undef SEQ_FOR_EACH_G6_
+#undef SEQ_FOR_EACH_G7_
+#undef SEQ_FOR_EACH_G8_
+#undef SEQ_FOR_EACH_G9_
+#undef SEQ_FOR_EACH_Ga_
+#undef SEQ_FOR_EACH_Gb_
+#undef SEQ_FOR_EACH_Gc_
+#undef SEQ_FOR_EACH_Gd_
+#undef SEQ_FOR_EACH_Ge_
+#undef SEQ_FOR_EACH_Gf_
+#undef SEQ_FOR_EACH_1
+#undef SEQ_FOR_EACH_2
+#undef SEQ_FOR_EACH_3
+#undef SEQ_FOR_EACH_4
+#undef SEQ_FOR_EACH_X1
+#undef SEQ_FOR_EACH_X2
+#undef SEQ_FOR_EACH_X3
+#undef SEQ_FOR_EACH_X4
+#undef SEQ_FOR_EACH_N
+#undef SEQ_FOR_EACH_N_
+#undef SEQ_FOR_EACH_1_0
+#undef SEQ_FOR_EACH_1_1
+#undef SEQ_FOR_EACH_1_2
+#undef SEQ_FOR_EACH_1_3
+#undef SEQ_FOR_EACH_1_4
+#undef SEQ_FOR_EACH_1_5
+#undef SEQ_FOR_EACH_1_6
+#undef SEQ_FOR_EACH_1_7
+#undef SEQ_FOR_EACH_1_8
+#undef SEQ_FOR_EACH_1_9
+#undef SEQ_FOR_EACH_1_a
+#undef SEQ_FOR_EACH_1_b
+#undef SEQ_FOR_EACH_1_c
+#undef SEQ_FOR_EACH_1_d
+#undef SEQ_FOR_EACH_1_e
+#undef SEQ_FOR_EACH_1_f
+#undef SEQ_FOR_EACH_1_10
+#undef SEQ_FOR_EACH_2_1
+#undef SEQ_FOR_EACH_2_2
+#undef SEQ_FOR_EACH_2_3
+#undef SEQ_FOR_EACH_2_4
+#undef SEQ_FOR_EACH_2_5
+#undef SEQ_FOR_EACH_2_6
+#undef SEQ_FOR_EACH_2_7
+#undef SEQ_FOR_EACH_2_8
+#undef SEQ_FOR_EACH_2_9
+#undef SEQ_FOR_EACH_2_a
+#undef SEQ_FOR_EACH_2_b
+#undef SEQ_FOR_EACH_2_c
+#undef SEQ_FOR_EACH_2_d
+#undef SEQ_FOR_EACH_2_e
+#undef SEQ_FOR_EACH_2_f
+#undef SEQ_FOR_EACH_2_10
+#undef SEQ_FOR_EACH_3_1
+#undef SEQ_FOR_EACH_3_2
+#undef SEQ_FOR_EACH_3_3
+#undef SEQ_FOR_EACH_3_4
+#undef SEQ_FOR_EACH_3_5
+#undef SEQ_FOR_EACH_3_6
+#undef SEQ_FOR_EACH_3_7
+#undef SEQ_FOR_EACH_3_8
+#undef SEQ_FOR_EACH_3_9
+#undef SEQ_FOR_EACH_3_a
+#undef SEQ_FOR_EACH_3_b
+#undef SEQ_FOR_EACH_3_c
+#undef SEQ_FOR_EACH_3_d
+#undef SEQ_FOR_EACH_3_e
+#undef SEQ_FOR_EACH_3_f
+#undef SEQ_FOR_EACH_3_10
+#undef SEQ_FOR_EACH_4_1
+#undef SEQ_FOR_EACH_4_2
+#undef SEQ_FOR_EACH_4_3
+#undef SEQ_FOR_EACH_4_4
+#undef SEQ_FOR_EACH_4_5
+#undef SEQ_FOR_EACH_4_6
+#undef SEQ_FOR_EACH_4_7
+#undef SEQ_FOR_EACH_4_8
+#undef SEQ_FOR_EACH_4_9
+#undef SEQ_FOR_EACH_4_a
+#undef SEQ_FOR_EACH_4_b
+#undef SEQ_FOR_EACH_4_c
+#undef SEQ_FOR_EACH_4_d
+#undef SEQ_FOR_EACH_4_e
+#undef SEQ_FOR_EACH_4_f
+#undef SEQ_FOR_EACH_4_10
+
+#undef DIGITS_HPP
+#undef DIGITS
+#undef DIGITS_DEC
+#undef DIGITS_HEX
+#undef DIGITS_VAL
+#undef DIGITS_VALUE
+#undef DIGITS_CHECK
+#undef DIGITS_BITS
+#undef DIGITS_DEC_LENGTH
+#undef DIGITS_HEX_LENGTH
+#undef DIGITS_POW10
+#undef DIGITS_V1
+#undef DIGITS_GE
+#undef DIGITS_NZ
+#undef DIGITS_DEC_AT
+#undef DIGITS_HEX_AT
+#undef DIGITS_PARSE
+
+#undef TRIANGLE_HPP
+#undef TRIANGLE
+#undef TRIANGLE_RUN
+#undef TRIANGLE_ARG
+#undef TRIANGLE_STEP_A
+#undef TRIANGLE_STEP_B
+#undef TRIANGLE_ROW_A
+#undef TRIANGLE_ROW_B
+#undef TRIANGLE_END_A
+#undef TRIANGLE_END_B
+
+#undef CCLASS_HPP
+#undef CCLASS
+#undef CCLASS_EVAL
+#undef CCLASS_BIT
+#undef CCLASS_MASK
+#undef CCLASS_TEST
+#undef CCLASS_ENTRY
+#undef CCLASS_DIGIT
+#undef CCLASS_UPPER
+#undef CCLASS_LOWER
+#undef CCLASS_ALPHA
+#undef CCLASS_ALNUM
+#undef CCLASS_XDIGIT
+#undef CCLASS_SPACE
+#undef CCLASS_PUNCT
+#undef CCLASS_IDSTART
+#undef CCLASS_IDCONT
+
+#undef SPSC_HPP
+#undef SPSC
+#undef SPSC_CHECK
+#undef SPSC_PUT
+#undef SPSC_GET
@@ -0,0 +1,217 @@
+// SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+// SPDX-License-Identifier: BSL-1.0
+// Only if IREPEATx100.hpp defined its subset, not skipped it for IREPEAT.hpp
+#if defined(IREPEATx100_HPP)
+#undef IREPEATx100_HPP
+
+#undef XREPEAT
+#undef IREPEAT
+
+#undef STR_
+#undef STR
+
+#undef CAT_
+#undef CAT
+
+#undef POSTCAT_
+#undef POSTCAT
+
+#undef EAT
+#undef IDEN
+#undef IDEP
+
+#undef ARG0_
+#undef ARG0
+
+#undef ARG1_
+#undef ARG1
+
+#undef SHEAD
+#undef SHED
+
+#undef SEQ0
+#undef SEQ1
+
+#undef CSV
+#undef CSVu
+#undef CSVv
+#undef CSVv_
+#undef CSVu_
+
+#undef LEN
+
+#undef VLEN_
+#undef VLEN
+
+#undef VCAT_
+#undef VCAT
+
+#undef SEQCAT
+
+#undef RMLZCAT
+
+#undef RMLZ
+#undef RMLZ_
+#undef RMLZ_0
+#undef RMLZ3
+
+#undef xD
+#undef XD
+#undef x0D
+#undef X0D
+
+#undef HEX
+#undef HEXLIT
+
+#undef NOSEP
+#undef COMMA
+#undef COLON
+
+#undef XREPS0
+#undef XREPS1
+#undef XREPS2
+#undef XREPS3
+#undef XREPS4
+#undef XREPS5
+#undef XREPS6
+#undef XREPS7
+#undef XREPS8
+#undef XREPS9
+#undef XREPSa
+#undef XREPSb
+#undef XREPSc
+#undef XREPSd
+#undef XREPSe
+#undef XREPSf
+#undef XREPS10
+
+#undef IREPS0
+#undef IREPS1
+#undef IREPS2
+#undef IREPS3
+#undef IREPS4
+#undef IREPS5
+#undef IREPS6
+#undef IREPS7
+#undef IREPS8
+#undef IREPS9
+#undef IREPSa
+#undef IREPSb
+#undef IREPSc
+#undef IREPSd
+#undef IREPSe
+#undef IREPSf
+
+#undef XREPT0
+#undef XREPT1
+#undef XREPT2
+#undef XREPT3
+#undef XREPT4
+#undef XREPT5
+#undef XREPT6
+#undef XREPT7
+#undef XREPT8
+#undef XREPT9
+#undef XREPTa
+#undef XREPTb
+#undef XREPTc
+#undef XREPTd
+#undef XREPTe
+#undef XREPTf
+
+#undef REPS_
+#undef REPS
+
+#undef XREPT
+#undef IREPT
+#undef REPT
+
+#undef PRE_0
+#undef PRE_1
+#undef PRE_2
+#undef PRE_3
+#undef PRE_4
+#undef PRE_5
+#undef PRE_6
+#undef PRE_7
+#undef PRE_8
+#undef PRE_9
+#undef PRE_a
+#undef PRE_b
+#undef PRE_c
+#undef PRE_d
+#undef PRE_e
+#undef PRE_f
+
+#undef PRED
+#undef PRE
+
+#undef POST_0
+#undef POST_1
+#undef POST_2
+#undef POST_3
+#undef POST_4
+#undef POST_5
+#undef POST_6
+#undef POST_7
+#undef POST_8
+#undef POST_9
+#undef POST_a
+#undef POST_b
+#undef POST_c
+#undef POST_d
+#undef POST_e
+#undef POST_f
+
+#undef POST
+
+#undef DECZ
+#undef DECZ1
+#undef DECZ2
+#undef DECZL
+#undef DECL0
+
+#undef DECD_0
+#undef DECD_1
+#undef DECD_2
+#undef DECD_3
+#undef DECD_4
+#undef DECD_5
+#undef DECD_6
+#undef DECD_7
+#undef DECD_8
+#undef DECD_9
+#undef DECD_a
+#undef DECD_b
+#undef DECD_c
+#undef DECD_d
+#undef DECD_e
+#undef DECD_f
+
+#undef DECH_0
+#undef DECH_1
+#undef DECH_2
+#undef DECH_3
+#undef DECH_4
+#undef DECH_5
+#undef DECH_6
+#undef DECH_7
+#undef DECH_8
+#undef DECH_9
+#undef DECH_a
+#undef DECH_b
+#undef DECH_c
+#undef DECH_d
+#undef DECH_e
+#undef DECH_f
+
+#undef DOREP1
+#undef DOREP2
+
+#undef REPEAT0
+
+#undef REPEAT1
+
+#undef REPEAT2
+
+#endif
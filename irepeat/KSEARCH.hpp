@@ -0,0 +1,57 @@
+#ifndef KSEARCH_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define KSEARCH_HPP // including the KSEARCH_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  KSEARCH(NAME,T,N,K) : Define unsigned NAME(T x), branchless lower bound
+  KRANK(NAME,T,N,K)   : Define unsigned NAME(T x), rank by N compares
+
+    NAME: name of the generated inline function
+    T: key type, a literal type with operator<
+    N: count of keys as HEXS digits, e.g. (1)(0)(0) == 256
+    K: key macro; K(H) is the H'th key, in ascending order
+
+  Both return the index of the first key not less than x, in [0,N],
+  as std::lower_bound. Depends on prior inclusion of IREPEAT.hpp.
+
+  KSEARCH is a fixed-depth binary search of ceil(log2(N)) steps, each
+  a masked add, with no branch; GCC 12 -O2 emits no conditional jump
+  for it, checked by objdump. N must be at least 1.
+  KRANK sums N comparisons of x against the keys as immediates,
+  with no table load, for a handful of keys.
+*/
+#endif
+
+#define KSEARCH(NAME,T,N,K) inline unsigned NAME(T ksearch_x) {\
+constexpr unsigned ksearch_n = HEXLIT(N);\
+static_assert(ksearch_n >= 1, "KSEARCH: N of at least 1");\
+static constexpr T ksearch_keys[ksearch_n ? ksearch_n : 1]\
+{XREPEAT(N,K,COMMA)};\
+unsigned ksearch_i = 0;\
+KSEARCH_STEP(0) KSEARCH_STEP(1) KSEARCH_STEP(2) KSEARCH_STEP(3)\
+KSEARCH_STEP(4) KSEARCH_STEP(5) KSEARCH_STEP(6) KSEARCH_STEP(7)\
+KSEARCH_STEP(8) KSEARCH_STEP(9) KSEARCH_STEP(10) KSEARCH_STEP(11)\
+KSEARCH_STEP(12) KSEARCH_STEP(13) KSEARCH_STEP(14) KSEARCH_STEP(15)\
+return ksearch_i + (ksearch_keys[ksearch_i] < ksearch_x); }
+
+// Step k halves a window of ceil(n/2^k) keys from ksearch_i, moving up
+// by the lower half if its last key is less than x; the window stays in
+// the table, so needs no bounds test. The move is the half masked by
+// the compare, as GCC compiles ?: or compare times half to branches.
+// Steps with a window of one key are constant-folded away
+#define KSEARCH_LEN(k) ((ksearch_n + (1u << k) - 1) >> k)
+#define KSEARCH_HALF(k) (KSEARCH_LEN(k) / 2)
+#define KSEARCH_STEP(k) if (KSEARCH_LEN(k) > 1) ksearch_i += KSEARCH_HALF(k)\
+& (0u - (ksearch_keys[ksearch_i + KSEARCH_HALF(k) - 1] < ksearch_x));
+
+#define KRANK(NAME,T,N,K) inline unsigned NAME(T ksearch_x) {\
+static constexpr T ksearch_keys[] {XREPEAT(N,K,COMMA)};\
+return 0 XREPEAT(N,KRANK_LT,NOSEP); }
+
+#define KRANK_LT(H) +(ksearch_keys[HEXLIT(H)] < ksearch_x)
+
+#endif
@@ -0,0 +1,83 @@
+#ifndef PT_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define PT_HPP // including the PT_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  Stackless coroutines, protothread style, with no heap frame
+
+    PT_STATE(N)     : declare the resume index, in the caller's struct
+    PT_BEGIN(s)     : begin the coroutine body of state struct s
+    PT_YIELD()      : return true, resume after this point
+    PT_AWAIT(cond)  : return true until cond holds, then continue
+    PT_RESTART()    : return true, resume from the beginning
+    PT_EXIT()       : return false, ended
+    PT_END()        : end the coroutine body, return false, ended
+
+    N: maximum count of resume points as HEXS digits, e.g. (1)(0) == 16
+
+  A coroutine is a function returning bool, true while running, with
+  body between PT_BEGIN and PT_END. Its state is a caller-owned struct
+  with a PT_STATE(N) member, the index of the next resume point, and
+  members for any values kept across resume points, as locals are not:
+
+    struct reader { PT_STATE((4)); unsigned n; };
+
+    bool read(reader& r, char c) {
+      PT_BEGIN(r)
+      for (r.n = 0; r.n != 3; ++r.n)
+        PT_AWAIT(c == 'x');
+      PT_END()
+    }
+
+  Depends on prior inclusion of IREPEAT.hpp.
+
+  The body is a switch on the resume index, with a case label at each
+  resume point, numbered 1, 2, ... by __COUNTER__ from PT_BEGIN, so
+  dense, for a jump table. PT_END checks the count against N, which
+  also sizes the index, uint8_t up to N = 254. After PT_END or PT_EXIT
+  the index is N + 1 and the coroutine returns false until restarted
+  by resetting the state, e.g. s = {}.
+  As with protothreads, the body must not switch across a resume point
+  nor use __COUNTER__ itself.
+*/
+#endif
+
+#include <cstdint>
+#include <type_traits>
+
+#define PT_STATE(N) enum : unsigned { pt_max = HEXLIT(N) };\
+std::conditional<(HEXLIT(N) < 0xff), std::uint8_t,\
+std::conditional<(HEXLIT(N) < 0xffff), std::uint16_t,\
+                 std::uint32_t>::type>::type pt_resume = 0
+
+#define PT_BEGIN(s) { auto& pt_s = s;\
+enum : unsigned { pt_base = __COUNTER__,\
+pt_done = std::remove_reference<decltype(s)>::type::pt_max + 1 };\
+switch (pt_s.pt_resume) { default: return false; case 0:;
+
+#define PT_YIELD() PT_YIELD_AT(__COUNTER__)
+#define PT_AWAIT(...) PT_AWAIT_AT(__COUNTER__,__VA_ARGS__)
+
+#define PT_RESTART() do { pt_s.pt_resume = 0; return true; } while (0)
+#define PT_EXIT() do { pt_s.pt_resume = pt_done; return false; } while (0)
+
+#define PT_END() PT_END_AT(__COUNTER__)
+
+// Resume point K - pt_base stores its index, returns, and resumes at
+// its case label; K is one __COUNTER__ value, used for both
+#define PT_YIELD_AT(K) do { pt_s.pt_resume = K - pt_base; return true;\
+case K - pt_base:; } while (0)
+
+// case K - pt_base is entered only by the switch, not by fallthrough
+#define PT_AWAIT_AT(K,...) do { pt_s.pt_resume = K - pt_base;\
+if (false) { case K - pt_base:; } if (!(__VA_ARGS__)) return true; } while (0)
+
+#define PT_END_AT(K) }\
+static_assert(K - pt_base - 1 < pt_done, "PT: more resume points than N");\
+pt_s.pt_resume = pt_done; return false; }
+
+#endif
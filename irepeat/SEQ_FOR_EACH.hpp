@@ -0,0 +1,200 @@
+#ifndef SEQ_FOR_EACH_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define SEQ_FOR_EACH_HPP // including the SEQ_FOR_EACH_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  SEQ_FOR_EACH_I(SEQ,M,S) : Repeat M(H,E) for each element E of SEQ,
+                            with separator S()
+
+    SEQ: sequence of elements (a)(b)(c)..., up to 65536 elements
+    M: macro / tokens to expand, each with index H and element E
+    S: separator-generator, e.g. COMMA / COLON / NOSEP
+
+  H is the element index as HEXS of as many digits as the last index
+  needs, as for IREPEAT, e.g. (0)(0) to (1)(3) for 20 elements.
+  Elements can't contain unparenthesized commas, and M can't use
+  SEQ_FOR_EACH_I. More than 65536 elements expand to a failing
+  static_assert. Depends on prior inclusion of IREPEAT.hpp.
+
+  Expansion is flat, with no recursion limit. The elements are grouped
+  into a 16-ary tree, one level per index digit, by one pass per level
+  of a 16-macro cycle that opens a group every 16 elements. Each level
+  then applies M, or the level below, to up to 16 arguments at a time
+  by a macro of fixed arity, adding one index digit, as IREPEAT does.
+*/
+#endif
+
+#define SEQ_FOR_EACH_I(SEQ,M,S) \
+SEQ_FOR_EACH_UP1(M,S,SEQ,SEQ_FOR_EACH_GROUP(SEQ))
+
+// SEQ_FOR_EACH_UPn(M,S,G,GG): apply at level n if GG, the groups of 16
+//                             of G, is one group, else group again
+#define SEQ_FOR_EACH_UP1(M,S,G,GG) \
+CAT(SEQ_FOR_EACH_UP1_,SEQ_FOR_EACH_ONE(GG))(M,S,G,GG)
+#define SEQ_FOR_EACH_UP1_1(M,S,G,GG) SEQ_FOR_EACH_1(M,S,,G)
+#define SEQ_FOR_EACH_UP1_0(M,S,G,GG) \
+SEQ_FOR_EACH_UP2(M,S,GG,SEQ_FOR_EACH_GROUP(GG))
+#define SEQ_FOR_EACH_UP2(M,S,G,GG) \
+CAT(SEQ_FOR_EACH_UP2_,SEQ_FOR_EACH_ONE(GG))(M,S,G,GG)
+#define SEQ_FOR_EACH_UP2_1(M,S,G,GG) SEQ_FOR_EACH_2(M,S,,G)
+#define SEQ_FOR_EACH_UP2_0(M,S,G,GG) \
+SEQ_FOR_EACH_UP3(M,S,GG,SEQ_FOR_EACH_GROUP(GG))
+#define SEQ_FOR_EACH_UP3(M,S,G,GG) \
+CAT(SEQ_FOR_EACH_UP3_,SEQ_FOR_EACH_ONE(GG))(M,S,G,GG)
+#define SEQ_FOR_EACH_UP3_1(M,S,G,GG) SEQ_FOR_EACH_3(M,S,,G)
+#define SEQ_FOR_EACH_UP3_0(M,S,G,GG) \
+SEQ_FOR_EACH_UP4(M,S,GG,SEQ_FOR_EACH_GROUP(GG))
+#define SEQ_FOR_EACH_UP4(M,S,G,GG) \
+CAT(SEQ_FOR_EACH_UP4_,SEQ_FOR_EACH_ONE(GG))(M,S,G,GG)
+#define SEQ_FOR_EACH_UP4_1(M,S,G,GG) SEQ_FOR_EACH_4(M,S,,G)
+#define SEQ_FOR_EACH_UP4_0(M,S,G,GG) \
+static_assert(false,"SEQ_FOR_EACH_I: more than 65536 elements");
+
+// SEQ_FOR_EACH_ONE(G): 1 if sequence G has at most one element, else 0
+#define SEQ_FOR_EACH_ONE(G) POSTCAT(_,SEQ_FOR_EACH_O0 G)
+#define SEQ_FOR_EACH_O0(...) SEQ_FOR_EACH_O1
+#define SEQ_FOR_EACH_O1(...) SEQ_FOR_EACH_O2
+#define SEQ_FOR_EACH_O2(...) SEQ_FOR_EACH_O3
+#define SEQ_FOR_EACH_O3(...) SEQ_FOR_EACH_O2
+#define SEQ_FOR_EACH_O0_ 1
+#define SEQ_FOR_EACH_O1_ 1
+#define SEQ_FOR_EACH_O2_ 0
+#define SEQ_FOR_EACH_O3_ 0
+
+// SEQ_FOR_EACH_GROUP(SEQ): SEQ as a sequence of groups of 16 elements,
+// ((a)(b)...(p))((q)...), the group parens deferred by NOSEP() until
+// the walk is done so that each step of it expands balanced
+#define SEQ_FOR_EACH_GROUP(SEQ) POSTCAT(_,SEQ_FOR_EACH_G0 SEQ)
+#define SEQ_FOR_EACH_LP() (
+#define SEQ_FOR_EACH_RP() )
+
+#define SEQ_FOR_EACH_G0(...) SEQ_FOR_EACH_LP NOSEP()()(__VA_ARGS__)SEQ_FOR_EACH_G1
+#define SEQ_FOR_EACH_G1(...) (__VA_ARGS__)SEQ_FOR_EACH_G2
+#define SEQ_FOR_EACH_G2(...) (__VA_ARGS__)SEQ_FOR_EACH_G3
+#define SEQ_FOR_EACH_G3(...) (__VA_ARGS__)SEQ_FOR_EACH_G4
+#define SEQ_FOR_EACH_G4(...) (__VA_ARGS__)SEQ_FOR_EACH_G5
+#define SEQ_FOR_EACH_G5(...) (__VA_ARGS__)SEQ_FOR_EACH_G6
+#define SEQ_FOR_EACH_G6(...) (__VA_ARGS__)SEQ_FOR_EACH_G7
+#define SEQ_FOR_EACH_G7(...) (__VA_ARGS__)SEQ_FOR_EACH_G8
+#define SEQ_FOR_EACH_G8(...) (__VA_ARGS__)SEQ_FOR_EACH_G9
+#define SEQ_FOR_EACH_G9(...) (__VA_ARGS__)SEQ_FOR_EACH_Ga
+#define SEQ_FOR_EACH_Ga(...) (__VA_ARGS__)SEQ_FOR_EACH_Gb
+#define SEQ_FOR_EACH_Gb(...) (__VA_ARGS__)SEQ_FOR_EACH_Gc
+#define SEQ_FOR_EACH_Gc(...) (__VA_ARGS__)SEQ_FOR_EACH_Gd
+#define SEQ_FOR_EACH_Gd(...) (__VA_ARGS__)SEQ_FOR_EACH_Ge
+#define SEQ_FOR_EACH_Ge(...) (__VA_ARGS__)SEQ_FOR_EACH_Gf
+#define SEQ_FOR_EACH_Gf(...) (__VA_ARGS__)SEQ_FOR_EACH_RP NOSEP()()SEQ_FOR_EACH_G0
+#define SEQ_FOR_EACH_G0_
+#define SEQ_FOR_EACH_G1_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G2_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G3_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G4_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G5_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G6_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G7_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G8_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_G9_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_Ga_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_Gb_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_Gc_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_Gd_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_Ge_ SEQ_FOR_EACH_RP()
+#define SEQ_FOR_EACH_Gf_ SEQ_FOR_EACH_RP()
+// SEQ_FOR_EACH_n(M,S,P,G): apply level n to the elements of group G,
+//                          the n'th digit of their index after P
+#define SEQ_FOR_EACH_1(M,S,P,G) SEQ_FOR_EACH_X1(M,S,P,CSV(G))
+#define SEQ_FOR_EACH_2(M,S,P,G) SEQ_FOR_EACH_X2(M,S,P,CSV(G))
+#define SEQ_FOR_EACH_3(M,S,P,G) SEQ_FOR_EACH_X3(M,S,P,CSV(G))
+#define SEQ_FOR_EACH_4(M,S,P,G) SEQ_FOR_EACH_X4(M,S,P,CSV(G))
+
+// Each level has its own X and arity macros, as nested expansions of
+// a macro inside itself aren't expanded, for DOREPn in IREPEAT.hpp
+#define SEQ_FOR_EACH_X1(M,S,P,...) \
+CAT(SEQ_FOR_EACH_1_,SEQ_FOR_EACH_N(__VA_ARGS__))(M,S,P,__VA_ARGS__)
+#define SEQ_FOR_EACH_X2(M,S,P,...) \
+CAT(SEQ_FOR_EACH_2_,SEQ_FOR_EACH_N(__VA_ARGS__))(M,S,P,__VA_ARGS__)
+#define SEQ_FOR_EACH_X3(M,S,P,...) \
+CAT(SEQ_FOR_EACH_3_,SEQ_FOR_EACH_N(__VA_ARGS__))(M,S,P,__VA_ARGS__)
+#define SEQ_FOR_EACH_X4(M,S,P,...) \
+CAT(SEQ_FOR_EACH_4_,SEQ_FOR_EACH_N(__VA_ARGS__))(M,S,P,__VA_ARGS__)
+
+// SEQ_FOR_EACH_N(...): count of CSV elements, 0 to 10 hex, less the
+//                      trailing empty argument that CSV leaves
+#define SEQ_FOR_EACH_N(...) SEQ_FOR_EACH_N_(__VA_ARGS__,\
+10,f,e,d,c,b,a,9,8,7,6,5,4,3,2,1,0,)
+#define SEQ_FOR_EACH_N_(A,B,C,D,E,F,G,H,I,J,K,L,M,N,O,P,Q,R,...) R
+
+#define SEQ_FOR_EACH_1_0(M,S,P,...)
+#define SEQ_FOR_EACH_1_1(M,S,P,_0,...) M(P(0),_0)
+#define SEQ_FOR_EACH_1_2(M,S,P,_0,_1,...) M(P(0),_0)S()M(P(1),_1)
+#define SEQ_FOR_EACH_1_3(M,S,P,_0,_1,_2,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)
+#define SEQ_FOR_EACH_1_4(M,S,P,_0,_1,_2,_3,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)
+#define SEQ_FOR_EACH_1_5(M,S,P,_0,_1,_2,_3,_4,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)
+#define SEQ_FOR_EACH_1_6(M,S,P,_0,_1,_2,_3,_4,_5,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)
+#define SEQ_FOR_EACH_1_7(M,S,P,_0,_1,_2,_3,_4,_5,_6,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)
+#define SEQ_FOR_EACH_1_8(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)
+#define SEQ_FOR_EACH_1_9(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)
+#define SEQ_FOR_EACH_1_a(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)
+#define SEQ_FOR_EACH_1_b(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)S()M(P(a),_a)
+#define SEQ_FOR_EACH_1_c(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)S()M(P(a),_a)S()M(P(b),_b)
+#define SEQ_FOR_EACH_1_d(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)S()M(P(a),_a)S()M(P(b),_b)S()M(P(c),_c)
+#define SEQ_FOR_EACH_1_e(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)S()M(P(a),_a)S()M(P(b),_b)S()M(P(c),_c)S()M(P(d),_d)
+#define SEQ_FOR_EACH_1_f(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)S()M(P(a),_a)S()M(P(b),_b)S()M(P(c),_c)S()M(P(d),_d)S()M(P(e),_e)
+#define SEQ_FOR_EACH_1_10(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,_f,...) M(P(0),_0)S()M(P(1),_1)S()M(P(2),_2)S()M(P(3),_3)S()M(P(4),_4)S()M(P(5),_5)S()M(P(6),_6)S()M(P(7),_7)S()M(P(8),_8)S()M(P(9),_9)S()M(P(a),_a)S()M(P(b),_b)S()M(P(c),_c)S()M(P(d),_d)S()M(P(e),_e)S()M(P(f),_f)
+
+#define SEQ_FOR_EACH_2_1(M,S,P,_0,...) SEQ_FOR_EACH_1(M,S,P(0),_0)
+#define SEQ_FOR_EACH_2_2(M,S,P,_0,_1,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)
+#define SEQ_FOR_EACH_2_3(M,S,P,_0,_1,_2,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)
+#define SEQ_FOR_EACH_2_4(M,S,P,_0,_1,_2,_3,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)
+#define SEQ_FOR_EACH_2_5(M,S,P,_0,_1,_2,_3,_4,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)
+#define SEQ_FOR_EACH_2_6(M,S,P,_0,_1,_2,_3,_4,_5,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)
+#define SEQ_FOR_EACH_2_7(M,S,P,_0,_1,_2,_3,_4,_5,_6,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)
+#define SEQ_FOR_EACH_2_8(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)
+#define SEQ_FOR_EACH_2_9(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)
+#define SEQ_FOR_EACH_2_a(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)
+#define SEQ_FOR_EACH_2_b(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)S()SEQ_FOR_EACH_1(M,S,P(a),_a)
+#define SEQ_FOR_EACH_2_c(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)S()SEQ_FOR_EACH_1(M,S,P(a),_a)S()SEQ_FOR_EACH_1(M,S,P(b),_b)
+#define SEQ_FOR_EACH_2_d(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)S()SEQ_FOR_EACH_1(M,S,P(a),_a)S()SEQ_FOR_EACH_1(M,S,P(b),_b)S()SEQ_FOR_EACH_1(M,S,P(c),_c)
+#define SEQ_FOR_EACH_2_e(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)S()SEQ_FOR_EACH_1(M,S,P(a),_a)S()SEQ_FOR_EACH_1(M,S,P(b),_b)S()SEQ_FOR_EACH_1(M,S,P(c),_c)S()SEQ_FOR_EACH_1(M,S,P(d),_d)
+#define SEQ_FOR_EACH_2_f(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)S()SEQ_FOR_EACH_1(M,S,P(a),_a)S()SEQ_FOR_EACH_1(M,S,P(b),_b)S()SEQ_FOR_EACH_1(M,S,P(c),_c)S()SEQ_FOR_EACH_1(M,S,P(d),_d)S()SEQ_FOR_EACH_1(M,S,P(e),_e)
+#define SEQ_FOR_EACH_2_10(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,_f,...) SEQ_FOR_EACH_1(M,S,P(0),_0)S()SEQ_FOR_EACH_1(M,S,P(1),_1)S()SEQ_FOR_EACH_1(M,S,P(2),_2)S()SEQ_FOR_EACH_1(M,S,P(3),_3)S()SEQ_FOR_EACH_1(M,S,P(4),_4)S()SEQ_FOR_EACH_1(M,S,P(5),_5)S()SEQ_FOR_EACH_1(M,S,P(6),_6)S()SEQ_FOR_EACH_1(M,S,P(7),_7)S()SEQ_FOR_EACH_1(M,S,P(8),_8)S()SEQ_FOR_EACH_1(M,S,P(9),_9)S()SEQ_FOR_EACH_1(M,S,P(a),_a)S()SEQ_FOR_EACH_1(M,S,P(b),_b)S()SEQ_FOR_EACH_1(M,S,P(c),_c)S()SEQ_FOR_EACH_1(M,S,P(d),_d)S()SEQ_FOR_EACH_1(M,S,P(e),_e)S()SEQ_FOR_EACH_1(M,S,P(f),_f)
+
+#define SEQ_FOR_EACH_3_1(M,S,P,_0,...) SEQ_FOR_EACH_2(M,S,P(0),_0)
+#define SEQ_FOR_EACH_3_2(M,S,P,_0,_1,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)
+#define SEQ_FOR_EACH_3_3(M,S,P,_0,_1,_2,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)
+#define SEQ_FOR_EACH_3_4(M,S,P,_0,_1,_2,_3,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)
+#define SEQ_FOR_EACH_3_5(M,S,P,_0,_1,_2,_3,_4,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)
+#define SEQ_FOR_EACH_3_6(M,S,P,_0,_1,_2,_3,_4,_5,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)
+#define SEQ_FOR_EACH_3_7(M,S,P,_0,_1,_2,_3,_4,_5,_6,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)
+#define SEQ_FOR_EACH_3_8(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)
+#define SEQ_FOR_EACH_3_9(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)
+#define SEQ_FOR_EACH_3_a(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)
+#define SEQ_FOR_EACH_3_b(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)S()SEQ_FOR_EACH_2(M,S,P(a),_a)
+#define SEQ_FOR_EACH_3_c(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)S()SEQ_FOR_EACH_2(M,S,P(a),_a)S()SEQ_FOR_EACH_2(M,S,P(b),_b)
+#define SEQ_FOR_EACH_3_d(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)S()SEQ_FOR_EACH_2(M,S,P(a),_a)S()SEQ_FOR_EACH_2(M,S,P(b),_b)S()SEQ_FOR_EACH_2(M,S,P(c),_c)
+#define SEQ_FOR_EACH_3_e(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)S()SEQ_FOR_EACH_2(M,S,P(a),_a)S()SEQ_FOR_EACH_2(M,S,P(b),_b)S()SEQ_FOR_EACH_2(M,S,P(c),_c)S()SEQ_FOR_EACH_2(M,S,P(d),_d)
+#define SEQ_FOR_EACH_3_f(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)S()SEQ_FOR_EACH_2(M,S,P(a),_a)S()SEQ_FOR_EACH_2(M,S,P(b),_b)S()SEQ_FOR_EACH_2(M,S,P(c),_c)S()SEQ_FOR_EACH_2(M,S,P(d),_d)S()SEQ_FOR_EACH_2(M,S,P(e),_e)
+#define SEQ_FOR_EACH_3_10(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,_f,...) SEQ_FOR_EACH_2(M,S,P(0),_0)S()SEQ_FOR_EACH_2(M,S,P(1),_1)S()SEQ_FOR_EACH_2(M,S,P(2),_2)S()SEQ_FOR_EACH_2(M,S,P(3),_3)S()SEQ_FOR_EACH_2(M,S,P(4),_4)S()SEQ_FOR_EACH_2(M,S,P(5),_5)S()SEQ_FOR_EACH_2(M,S,P(6),_6)S()SEQ_FOR_EACH_2(M,S,P(7),_7)S()SEQ_FOR_EACH_2(M,S,P(8),_8)S()SEQ_FOR_EACH_2(M,S,P(9),_9)S()SEQ_FOR_EACH_2(M,S,P(a),_a)S()SEQ_FOR_EACH_2(M,S,P(b),_b)S()SEQ_FOR_EACH_2(M,S,P(c),_c)S()SEQ_FOR_EACH_2(M,S,P(d),_d)S()SEQ_FOR_EACH_2(M,S,P(e),_e)S()SEQ_FOR_EACH_2(M,S,P(f),_f)
+
+#define SEQ_FOR_EACH_4_1(M,S,P,_0,...) SEQ_FOR_EACH_3(M,S,P(0),_0)
+#define SEQ_FOR_EACH_4_2(M,S,P,_0,_1,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)
+#define SEQ_FOR_EACH_4_3(M,S,P,_0,_1,_2,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)
+#define SEQ_FOR_EACH_4_4(M,S,P,_0,_1,_2,_3,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)
+#define SEQ_FOR_EACH_4_5(M,S,P,_0,_1,_2,_3,_4,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)
+#define SEQ_FOR_EACH_4_6(M,S,P,_0,_1,_2,_3,_4,_5,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)
+#define SEQ_FOR_EACH_4_7(M,S,P,_0,_1,_2,_3,_4,_5,_6,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)
+#define SEQ_FOR_EACH_4_8(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)
+#define SEQ_FOR_EACH_4_9(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)
+#define SEQ_FOR_EACH_4_a(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)
+#define SEQ_FOR_EACH_4_b(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)S()SEQ_FOR_EACH_3(M,S,P(a),_a)
+#define SEQ_FOR_EACH_4_c(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)S()SEQ_FOR_EACH_3(M,S,P(a),_a)S()SEQ_FOR_EACH_3(M,S,P(b),_b)
+#define SEQ_FOR_EACH_4_d(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)S()SEQ_FOR_EACH_3(M,S,P(a),_a)S()SEQ_FOR_EACH_3(M,S,P(b),_b)S()SEQ_FOR_EACH_3(M,S,P(c),_c)
+#define SEQ_FOR_EACH_4_e(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)S()SEQ_FOR_EACH_3(M,S,P(a),_a)S()SEQ_FOR_EACH_3(M,S,P(b),_b)S()SEQ_FOR_EACH_3(M,S,P(c),_c)S()SEQ_FOR_EACH_3(M,S,P(d),_d)
+#define SEQ_FOR_EACH_4_f(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)S()SEQ_FOR_EACH_3(M,S,P(a),_a)S()SEQ_FOR_EACH_3(M,S,P(b),_b)S()SEQ_FOR_EACH_3(M,S,P(c),_c)S()SEQ_FOR_EACH_3(M,S,P(d),_d)S()SEQ_FOR_EACH_3(M,S,P(e),_e)
+#define SEQ_FOR_EACH_4_10(M,S,P,_0,_1,_2,_3,_4,_5,_6,_7,_8,_9,_a,_b,_c,_d,_e,_f,...) SEQ_FOR_EACH_3(M,S,P(0),_0)S()SEQ_FOR_EACH_3(M,S,P(1),_1)S()SEQ_FOR_EACH_3(M,S,P(2),_2)S()SEQ_FOR_EACH_3(M,S,P(3),_3)S()SEQ_FOR_EACH_3(M,S,P(4),_4)S()SEQ_FOR_EACH_3(M,S,P(5),_5)S()SEQ_FOR_EACH_3(M,S,P(6),_6)S()SEQ_FOR_EACH_3(M,S,P(7),_7)S()SEQ_FOR_EACH_3(M,S,P(8),_8)S()SEQ_FOR_EACH_3(M,S,P(9),_9)S()SEQ_FOR_EACH_3(M,S,P(a),_a)S()SEQ_FOR_EACH_3(M,S,P(b),_b)S()SEQ_FOR_EACH_3(M,S,P(c),_c)S()SEQ_FOR_EACH_3(M,S,P(d),_d)S()SEQ_FOR_EACH_3(M,S,P(e),_e)S()SEQ_FOR_EACH_3(M,S,P(f),_f)
+
+#endif
@@ -0,0 +1,40 @@
+#ifndef SHARDS_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define SHARDS_HPP // including the SHARDS_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  SHARDS(NAME,T,N) : Define struct NAME of N slots, one per cache line
+
+    NAME: name of the generated struct
+    T: slot type, e.g. std::atomic<unsigned long>, up to 64 bytes
+    N: count of slots as HEXS digits, e.g. (1)(0) == 16
+
+  The generated struct has, for slot index H as HEXS, e.g. (0)(3),
+
+    alignas(64) T x0D(H) : the slot, e.g. x03, on its own cache line
+    operator[](i)        : slot i by a table of member pointers
+    sum()                : the sum of all slots, unrolled
+
+  and static constexpr unsigned size. Each slot is written by one
+  thread, so that no two threads' slots share a cache line.
+  Depends on prior inclusion of IREPEAT.hpp.
+*/
+#endif
+
+#define SHARDS(NAME,T,N) struct NAME {\
+static constexpr unsigned size = HEXLIT(N);\
+XREPEAT(N,alignas(64) T x0D,COLON);\
+T& operator[](unsigned shards_i) {\
+static constexpr T NAME::* shards_slots[] {XREPEAT(N,&NAME::x0D,COMMA)};\
+return this->*shards_slots[shards_i]; }\
+T const& operator[](unsigned shards_i) const {\
+static constexpr T NAME::* shards_slots[] {XREPEAT(N,&NAME::x0D,COMMA)};\
+return this->*shards_slots[shards_i]; }\
+auto sum() const -> decltype(x0D(DECZ(N)) + x0D(DECZ(N)))\
+{ return XREPEAT(N,x0D,+ EAT); } };
+
+#endif
@@ -0,0 +1,54 @@
+#ifndef SOA_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define SOA_HPP // including the SOA_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  SOA(NAME,N,F,CAP) : Define struct NAME, a structure of field arrays
+
+    NAME: name of the generated struct
+    N: count of fields as HEXS digits, e.g. (3) == 3
+    F: field macro; F(H) is the H'th field as (type,name)
+    CAP: capacity as HEXS digits, the length of each field array
+
+  The generated struct has, for each field (T,name) and row index i,
+
+    alignas(64) T name[CAP]   : the field array, starting a cache line
+    NAME::row, NAME::const_row : proxy row views, members T& name
+    operator[](i)              : the row view of element i
+    copy(to,from), swap(i,j)   : copy or swap elements, field by field
+
+  and static constexpr unsigned capacity. Field names must not clash
+  with these member names. Depends on prior inclusion of IREPEAT.hpp.
+*/
+#endif
+
+#define SOA(NAME,N,F,CAP) struct NAME {\
+static constexpr unsigned capacity = HEXLIT(CAP);\
+SOA_EVAL(XREPEAT(N,SOA_ARRAY F,NOSEP))\
+struct row { SOA_EVAL(XREPEAT(N,SOA_REF F,NOSEP)) };\
+struct const_row { SOA_EVAL(XREPEAT(N,SOA_CREF F,NOSEP)) };\
+row operator[](unsigned soa_i)\
+{ return {SOA_EVAL(XREPEAT(N,SOA_AT F,COMMA))}; }\
+const_row operator[](unsigned soa_i) const\
+{ return {SOA_EVAL(XREPEAT(N,SOA_AT F,COMMA))}; }\
+void copy(unsigned soa_to, unsigned soa_from)\
+{ SOA_EVAL(XREPEAT(N,SOA_COPY F,NOSEP)) }\
+void swap(unsigned soa_i, unsigned soa_j)\
+{ SOA_EVAL(XREPEAT(N,SOA_SWAP F,NOSEP)) } };
+
+// SOA_EVAL(...): rescan XREPEAT(N,SOA_X F,S) -> SOA_X (T,name) S() ...
+#define SOA_EVAL(...) __VA_ARGS__
+
+#define SOA_ARRAY(T,NAME) alignas(64) T NAME[capacity];
+#define SOA_REF(T,NAME) T& NAME;
+#define SOA_CREF(T,NAME) T const& NAME;
+#define SOA_AT(T,NAME) NAME[soa_i]
+#define SOA_COPY(T,NAME) NAME[soa_to] = NAME[soa_from];
+#define SOA_SWAP(T,NAME) { T soa_t = NAME[soa_i];\
+NAME[soa_i] = NAME[soa_j]; NAME[soa_j] = soa_t; }
+
+#endif
@@ -0,0 +1,58 @@
+#ifndef SORTNET_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define SORTNET_HPP // including the SORTNET_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  SORTNET(NAME,T,N) : Define void NAME(T* a), sort N elements ascending
+
+    NAME: name of the generated inline function
+    T: element type, copyable with operator<
+    N: count of elements as HEXS digits, e.g. (2)(0) == 32, up to 64
+
+  Batcher's odd-even merge sort network, as flat compare-exchanges
+    a[i], a[j] = min(a[i],a[j]), max(a[i],a[j])
+  by conditional moves, with no data-dependent branches.
+  Depends on prior inclusion of IREPEAT.hpp.
+
+  Each stage (p,k) repeats a compare-exchange of a[x], a[x+k] over
+  positions x, under a constant condition that x starts a comparator;
+  the compiler folds it, leaving only the network's comparators.
+*/
+#endif
+
+#define SORTNET(NAME,T,N) inline void NAME(T* sortnet_a) {\
+constexpr unsigned sortnet_n = HEXLIT(N);\
+static_assert(sortnet_n <= 64, "SORTNET: N > 64");\
+SORTNET_STAGE(N,1,1)\
+SORTNET_STAGE(N,2,2) SORTNET_STAGE(N,2,1)\
+SORTNET_STAGE(N,4,4) SORTNET_STAGE(N,4,2) SORTNET_STAGE(N,4,1)\
+SORTNET_STAGE(N,8,8) SORTNET_STAGE(N,8,4) SORTNET_STAGE(N,8,2)\
+SORTNET_STAGE(N,8,1)\
+SORTNET_STAGE(N,16,16) SORTNET_STAGE(N,16,8) SORTNET_STAGE(N,16,4)\
+SORTNET_STAGE(N,16,2) SORTNET_STAGE(N,16,1)\
+SORTNET_STAGE(N,32,32) SORTNET_STAGE(N,32,16) SORTNET_STAGE(N,32,8)\
+SORTNET_STAGE(N,32,4) SORTNET_STAGE(N,32,2) SORTNET_STAGE(N,32,1) }
+
+// Stages with p >= n are constant-folded away
+#define SORTNET_STAGE(N,P,K) if (P < sortnet_n) {\
+constexpr unsigned sortnet_p = P, sortnet_k = K;\
+XREPEAT(N,SORTNET_CX,NOSEP) }
+
+// Comparator x, x+k in merge p of 2p runs, at offsets k%p + m*2k + [0,k)
+#define SORTNET_CX(H) if (SORTNET_IS_CX(HEXLIT(H))) {\
+auto& sortnet_x = sortnet_a[HEXLIT(H)];\
+auto& sortnet_y = sortnet_a[HEXLIT(H) + sortnet_k];\
+auto sortnet_lo = sortnet_y < sortnet_x ? sortnet_y : sortnet_x;\
+sortnet_y = sortnet_y < sortnet_x ? sortnet_x : sortnet_y;\
+sortnet_x = sortnet_lo; }
+
+#define SORTNET_IS_CX(X) (X + sortnet_k < sortnet_n\
+ && X >= sortnet_k % sortnet_p\
+ && (X - sortnet_k % sortnet_p) % (2 * sortnet_k) < sortnet_k\
+ && X / (2 * sortnet_p) == (X + sortnet_k) / (2 * sortnet_p))
+
+#endif
@@ -0,0 +1,80 @@
+#ifndef SPSC_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define SPSC_HPP // including the SPSC_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  SPSC(NAME,T,CAP) : Define struct NAME, a lock-free single-producer
+                     single-consumer ring buffer of CAP elements of T
+
+    NAME: name of the generated struct
+    T: element type, copy assigned in and out, e.g. trivially copyable
+    CAP: capacity as HEXS digits, a power of two, e.g. (4)(0)(0) == 1024
+
+  The generated struct has
+
+    push_n<B>(src) : push B elements src[0..B), all or none, true if so
+    pop_n<B>(dst)  : pop B elements to dst[0..B), all or none, true if so
+    push(v), pop(v) : push_n<1>, pop_n<1> of one element
+
+  and static constexpr unsigned capacity. Batch size B is 1 to 64,
+  at most CAP. Only one thread may push and one other thread pop.
+  Depends on prior inclusion of IREPEAT.hpp.
+
+  The tail index, written by the producer, and the head, written by
+  the consumer, are on separate cache lines, each with a copy of the
+  other's last seen value, so the other's line is read only when the
+  copy shows too little space, or too few elements, for the batch.
+  Indices run free, masked by CAP-1 on access. The copy of a batch
+  is XREPEAT((4)(0),...), each element under a constant condition of
+  its index under B, which the compiler folds, as in SORTNET.hpp,
+  leaving B masked copies with no loop and no per-element branch.
+*/
+#endif
+
+#include <atomic>
+#include <cstddef>
+
+#define SPSC(NAME,T,CAP) struct NAME {\
+static constexpr unsigned capacity = HEXLIT(CAP);\
+static_assert(capacity >= 2 && (capacity & (capacity - 1)) == 0,\
+"SPSC: CAP a power of two");\
+template <unsigned B> bool push_n(T const* spsc_src) {\
+SPSC_CHECK(B);\
+std::size_t const spsc_t = spsc_tail.load(std::memory_order_relaxed);\
+if (spsc_t - spsc_head_seen > capacity - B) {\
+spsc_head_seen = spsc_head.load(std::memory_order_acquire);\
+if (spsc_t - spsc_head_seen > capacity - B) return false; }\
+XREPEAT((4)(0),SPSC_PUT,NOSEP)\
+spsc_tail.store(spsc_t + B, std::memory_order_release);\
+return true; }\
+template <unsigned B> bool pop_n(T* spsc_dst) {\
+SPSC_CHECK(B);\
+std::size_t const spsc_h = spsc_head.load(std::memory_order_relaxed);\
+if (spsc_tail_seen - spsc_h < B) {\
+spsc_tail_seen = spsc_tail.load(std::memory_order_acquire);\
+if (spsc_tail_seen - spsc_h < B) return false; }\
+XREPEAT((4)(0),SPSC_GET,NOSEP)\
+spsc_head.store(spsc_h + B, std::memory_order_release);\
+return true; }\
+bool push(T const& spsc_v) { return push_n<1>(&spsc_v); }\
+bool pop(T& spsc_v) { return pop_n<1>(&spsc_v); }\
+alignas(64) std::atomic<std::size_t> spsc_tail{0};\
+std::size_t spsc_head_seen = 0;\
+alignas(64) std::atomic<std::size_t> spsc_head{0};\
+std::size_t spsc_tail_seen = 0;\
+alignas(64) T spsc_buf[capacity]; };
+
+#define SPSC_CHECK(B) static_assert(B >= 1 && B <= 64 && B <= capacity,\
+"SPSC: batch of 1 to 64, at most CAP")
+
+// Element H of the batch, folded away for H >= B
+#define SPSC_PUT(H) if (HEXLIT(H) < B)\
+spsc_buf[(spsc_t + HEXLIT(H)) & (capacity - 1)] = spsc_src[HEXLIT(H)];
+#define SPSC_GET(H) if (HEXLIT(H) < B)\
+spsc_dst[HEXLIT(H)] = spsc_buf[(spsc_h + HEXLIT(H)) & (capacity - 1)];
+
+#endif
@@ -0,0 +1,79 @@
+#ifndef STRTAB_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define STRTAB_HPP // including the STRTAB_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  STRTAB(NAME,N,F) : Define struct NAME, a table of N strings in one blob
+
+    NAME: name of the generated struct
+    N: count of strings as HEXS digits, e.g. (1)(0)(0)(0) == 4096
+    F: string macro; F(H) is the H'th string, a string literal
+
+  The generated struct has static member functions
+
+    NAME::blob()    : the strings, each null terminated, end to end
+    NAME::offset(i) : the offset of the i'th string in the blob, i <= N
+    NAME::c_str(i)  : the i'th string, blob() + offset(i)
+    NAME::length(i) : the length of the i'th string
+    NAME::view(i)   : the i'th string as std::string_view, C++17
+
+  and static constexpr unsigned count. Depends on prior inclusion
+  of IREPEAT.hpp.
+
+  The blob is one string literal, F(0) "\0" F(1) "\0" ..., indexed
+  by a table of offsets, uint16_t for a blob of up to 64K else uint32_t.
+  Unlike an array of const char* there are no pointers to relocate,
+  in position independent executables or shared libraries.
+  MSVC limits a string literal to 64K, so limits the blob size.
+*/
+#endif
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+
+#if __cplusplus >= 201703L || _MSVC_LANG >= 201703L
+#include <string_view>
+#define STRTAB_VIEW static std::string_view view(unsigned strtab_i)\
+{ return {c_str(strtab_i), length(strtab_i)}; }
+#else
+#define STRTAB_VIEW
+#endif
+
+// Offsets are the running sum of enumerators xH = XH + 1, with
+// XH = x(H-1) + sizeof F(H) - 1, in block scope for fast lookup
+#define STRTAB(NAME,N,F) struct NAME {\
+static constexpr unsigned count = HEXLIT(N);\
+static char const* blob() {\
+static constexpr char strtab_b[] = XREPEAT(N,F,STRTAB_NUL);\
+return strtab_b; }\
+static std::size_t offset(unsigned strtab_i) {\
+enum : std::uint32_t { strtab_o = 0 +\
+STRTAB_EVAL(XREPEAT(N,sizeof F LENCAT(STRTAB_END,N),NOSEP)) 0, strtab_end };\
+using offset_type = std::conditional<strtab_end <= 0x10000,\
+                            std::uint16_t, std::uint32_t>::type;\
+static constexpr offset_type strtab_offsets[]\
+{0, XREPEAT(N,LENCAT(x0D,N),COMMA)};\
+return strtab_offsets[strtab_i]; }\
+static char const* c_str(unsigned strtab_i)\
+{ return blob() + offset(strtab_i); }\
+static std::size_t length(unsigned strtab_i)\
+{ return offset(strtab_i + 1) - offset(strtab_i) - 1u; }\
+STRTAB_VIEW };
+
+#define STRTAB_NUL() "\0"
+
+// STRTAB_EVAL(...): rescan sizeof F (H) - 1, ... to expand F(H)
+#define STRTAB_EVAL(...) __VA_ARGS__
+
+// STRTAB_ENDn(H): the running sum step after sizeof F, for n digit H
+#define STRTAB_END1(H) (H) - 1, x0D1(H), X0D1(H) = x0D1(H) +
+#define STRTAB_END2(H) (H) - 1, x0D2(H), X0D2(H) = x0D2(H) +
+#define STRTAB_END3(H) (H) - 1, x0D3(H), X0D3(H) = x0D3(H) +
+#define STRTAB_END4(H) (H) - 1, x0D4(H), X0D4(H) = x0D4(H) +
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef TRIANGLE_HPP // IREPEAT_UNDEF.hpp #undef's all #define'd symbols
+#define TRIANGLE_HPP // including the TRIANGLE_HPP header guard.
+
+#if 0 /*
+  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+  SPDX-License-Identifier: BSL-1.0
+
+  Repo: https://github.com/Lemuriad/IREPEAT
+
+  TRIANGLE(N,M,S,R,T) : Rows R(H,...) for H in [0,N], separated by T(),
+                        row H being M((0)) S() M((1)) S() ... M(H)
+
+    N: last row index as HEXS digits, e.g. (f)(f) for 256 rows
+    M: element macro; M(H) is the H'th element, as for IREPEAT
+    S: element separator-generator, e.g. COMMA
+    R: row macro; R(H,...) is row H, with its elements as __VA_ARGS__
+    T: row separator-generator, e.g. COMMA
+
+  Depends on prior inclusion of IREPEAT.hpp.
+
+  Row H is row H-1 with M(H) appended, so each M(H) is expanded once,
+  where a nested repeat expands it again in each of N-H+1 rows.
+  The output is still quadratic, but only as copies of expanded rows.
+
+  Each row is passed on to the next as a macro argument, as arguments
+  are expanded once, then copied; a macro redefined for each row with
+  the previous row in its body would instead re-expand the whole row,
+  as #define doesn't expand its body.
+  A step's expansion ends by opening the call of the next step, whose
+  last arguments, the index H, come from a sequence of IREPEAT(N,...),
+  so each step's context is done before the next and memory is held
+  for the current row only. M and R can use IREPEAT but not TRIANGLE.
+  GCC tracks each element's location through every row it's passed in;
+  -ftrack-macro-expansion=0 saves that memory, and the time to resolve
+  the locations for -E output, which grows with rows times row length.
+*/
+#endif
+
+#define TRIANGLE(N,M,S,R,T) TRIANGLE_RUN(TRIANGLE_STEP_A NOSEP()\
+(M,S,R,T,EAT,EAT,() IREPEAT(N,TRIANGLE_ARG,NOSEP) ,(0),TRIANGLE_END))
+
+// TRIANGLE_RUN(...): rescan, to run the deferred first TRIANGLE_STEP_A
+#define TRIANGLE_RUN(...) __VA_ARGS__
+
+// TRIANGLE_ARG(H): the last arguments of the step for row H
+#define TRIANGLE_ARG(H) ,H,TRIANGLE_ROW)
+
+// TRIANGLE_STEP_A(M,S,R,T,QS,QT,(ROW),H,K): K_A with row H, ROW QS() M(H)
+//   QS, QT: separators before the next element and the next row,
+//           EAT for the first, else S and T
+//   K: TRIANGLE_ROW, or TRIANGLE_END after the last row
+// Steps alternate, A then B, as a step is still disabled when the name
+// of the next step is read, at the end of its context, as for CSVu, CSVv
+#define TRIANGLE_STEP_A(M,S,R,T,QS,QT,ROW,H,K) K##_A(M,S,R,T,QT,H,\
+IDEN ROW QS() M(H))
+#define TRIANGLE_STEP_B(M,S,R,T,QS,QT,ROW,H,K) K##_B(M,S,R,T,QT,H,\
+IDEN ROW QS() M(H))
+
+// TRIANGLE_ROW_A(M,S,R,T,QT,H,...): output row H, then open the next step
+#define TRIANGLE_ROW_A(M,S,R,T,QT,H,...) QT() R(H,__VA_ARGS__)\
+ TRIANGLE_STEP_B(M,S,R,T,S,T,(__VA_ARGS__)
+#define TRIANGLE_ROW_B(M,S,R,T,QT,H,...) QT() R(H,__VA_ARGS__)\
+ TRIANGLE_STEP_A(M,S,R,T,S,T,(__VA_ARGS__)
+
+#define TRIANGLE_END_A(...)
+#define TRIANGLE_END_B(...)
+
+#endif
@@ -7,6 +7,11 @@
 #if __has_include(STR(VREPEAT_MACRO))
 #define VREPEAT_MACRO_STR STR(VREPEAT_MACRO)
 #endif
+#if defined VREPEAT_SEPARATOR
+#define VREPEAT_SEP VREPEAT_SEPARATOR
+#else
+#define VREPEAT_SEP EAT
+#endif
 
 #define NDIGITS LEN(VREPEAT_COUNT)
 #if NDIGITS == 1
@@ -27,12 +32,29 @@
 #  define C1 SEQ2(VREPEAT_COUNT)
 #  define C0 SEQ3(VREPEAT_COUNT)
 #  include "VREPEATx10000.hpp"
+#elif NDIGITS == 5
+#  define C4 SEQ0(VREPEAT_COUNT)
+#  define C3 SEQ1(VREPEAT_COUNT)
+#  define C2 SEQ2(VREPEAT_COUNT)
+#  define C1 SEQ3(VREPEAT_COUNT)
+#  define C0 SEQ4(VREPEAT_COUNT)
+#  include "VREPEATx100000.hpp"
+#elif NDIGITS == 6
+#  define C5 SEQ0(VREPEAT_COUNT)
+#  define C4 SEQ1(VREPEAT_COUNT)
+#  define C3 SEQ2(VREPEAT_COUNT)
+#  define C2 SEQ3(VREPEAT_COUNT)
+#  define C1 SEQ4(VREPEAT_COUNT)
+#  define C0 SEQ5(VREPEAT_COUNT)
+#  include "VREPEATx1000000.hpp"
 #endif
 
 #undef C0
 #undef C1
 #undef C2
 #undef C3
+#undef C4
+#undef C5
 
 #undef D3D2D1
 
@@ -40,5 +62,6 @@
 #undef VREPEAT_MACRO
 #undef VREPEAT_MACRO_STR
 #undef VREPEAT_SEPARATOR
+#undef VREPEAT_SEP
 #undef NDIGITS
 #undef NREPEATS
@@ -9,6 +9,8 @@
 #define D3D2D1
 #endif
 
+#if defined VREPEAT_MACRO_STR // include mode; dispatch each repeat
+
 #define D0 0
 #include "VREPEAT_DISPATCH.hpp"
 #define D0 1
@@ -72,6 +74,95 @@
 #endif
 #endif
 
+#else // macro mode; expand each repeat inline, separator first
+
+#define VREPEAT_INDEX D3D2D1(D0)
+#define NREPEAT CAT(OxD3D2D1,D0)
+#define D0 0
+#if NREPEAT != 0
+VREPEAT_SEP()
+#endif
+VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 1
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 2
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 3
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 4
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 5
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 6
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 7
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 8
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 9
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 a
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 b
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 c
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 d
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 e
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#undef D0
+#define D0 f
+#if NREPEAT <= NREPEATS
+VREPEAT_SEP()VREPEAT_MACRO(VREPEAT_INDEX)
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#undef VREPEAT_INDEX
+#undef NREPEAT
+
+#endif
+
 #undef OxD3D2D1
 
 #undef D0
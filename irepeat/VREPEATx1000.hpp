@@ -3,8 +3,8 @@
  SPDX-License-Identifier: BSL-1.0
 #endif
 #if defined(C3)
-#define OxD3 CAT(0x,D3)
-#define D3D2 (D3)(D2)
+#define OxD3 CAT(OxD5D4,D3)
+#define D3D2 D5D4D3(D2)
 #else
 #define OxD3 0x
 #define D3D2 (D2)
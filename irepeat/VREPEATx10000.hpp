@@ -2,62 +2,60 @@
  SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
  SPDX-License-Identifier: BSL-1.0
 #endif
-#if 0
-#if defined(C4) // C4 would be a 5th count digit
-#define Ox
-#define D3
+#if defined(C4)
+#define OxD5D4 CAT(OxD5,D4)
+#define D5D4D3 D5D4(D3)
 #else
-#define Ox (C3)
-#define D3 (D3)
-#endif
+#define OxD5D4 0x
+#define D5D4D3 (D3)
 #endif
 
 #define D3 0
 #include "VREPEATx1000.hpp"
 #define D3 1
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 2
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 3
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 4
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 5
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 6
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 7
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 8
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 9
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 a
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 b
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 c
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 d
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 e
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #define D3 f
-#if HEX(D3) <= HEX(C3)
+#if CAT(OxD5D4,D3)*0x1000 <= NREPEATS
 #include "VREPEATx1000.hpp"
 #endif
 #endif
@@ -75,8 +73,8 @@
 #endif
 #endif
 
-//#undef Ox
-//#undef D3
+#undef OxD5D4
+#undef D5D4D3
 
 #undef D3
-//#undef D4
+#undef D4
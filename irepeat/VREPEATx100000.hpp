@@ -0,0 +1,80 @@
+#if 0
+ SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+ SPDX-License-Identifier: BSL-1.0
+#endif
+#if defined(C5)
+#define OxD5 CAT(0x,D5)
+#define D5D4 (D5)(D4)
+#else
+#define OxD5 0x
+#define D5D4 (D4)
+#endif
+
+#define D4 0
+#include "VREPEATx10000.hpp"
+#define D4 1
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 2
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 3
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 4
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 5
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 6
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 7
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 8
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 9
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 a
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 b
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 c
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 d
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 e
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#define D4 f
+#if CAT(OxD5,D4)*0x10000 <= NREPEATS
+#include "VREPEATx10000.hpp"
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+
+#undef OxD5
+#undef D5D4
+
+#undef D4
+#undef D5
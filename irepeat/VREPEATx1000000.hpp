@@ -0,0 +1,69 @@
+#if 0
+ SPDX-FileCopyrightText: 2024 The Lemuriad <wjwray@gmail.com>
+ SPDX-License-Identifier: BSL-1.0
+#endif
+
+#define D5 0
+#include "VREPEATx100000.hpp"
+#define D5 1
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 2
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 3
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 4
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 5
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 6
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 7
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 8
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 9
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 a
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 b
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 c
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 d
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 e
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#define D5 f
+#if HEX(D5) <= HEX(C5)
+#include "VREPEATx100000.hpp"
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+#endif
+
+#undef D5
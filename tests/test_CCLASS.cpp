@@ -0,0 +1,74 @@
+#include "IREPEAT.hpp"
+#include "CCLASS.hpp"
+
+#include <cctype>
+
+/*
+   Tests for CCLASS.hpp bit-packed character class tables.
+
+   Masks and types are checked by static_assert, and every byte's
+   table entry against its predicates and the "C" locale <cctype>
+   classes in main(), failing with a nonzero exit.
+ */
+
+// All ten ASCII classes, sixteen bit entries
+#define LEX(H) CAT(LEX_,SEQCAT(H))
+#define LEX_0 (digit,CCLASS_DIGIT)
+#define LEX_1 (xdigit,CCLASS_XDIGIT)
+#define LEX_2 (upper,CCLASS_UPPER)
+#define LEX_3 (lower,CCLASS_LOWER)
+#define LEX_4 (alpha,CCLASS_ALPHA)
+#define LEX_5 (alnum,CCLASS_ALNUM)
+#define LEX_6 (space,CCLASS_SPACE)
+#define LEX_7 (punct,CCLASS_PUNCT)
+#define LEX_8 (idstart,CCLASS_IDSTART)
+#define LEX_9 (idcont,CCLASS_IDCONT)
+
+CCLASS(lex,(a),LEX)
+
+// Two classes, one a user predicate, eight bit entries
+#define QUOTE(C) ((C) == '"' || (C) == '\'')
+#define TOK(H) CAT(TOK_,SEQCAT(H))
+#define TOK_0 (quote,QUOTE)
+#define TOK_1 (space,CCLASS_SPACE)
+
+CCLASS(tok,(2),TOK)
+
+static_assert(sizeof(lex::type) == 2 && sizeof(tok::type) == 1, "");
+static_assert(lex::bit::digit == 0 && lex::bit::idcont == 9, "");
+static_assert(lex::digit == 1 && lex::idcont == 0x200, "");
+static_assert(tok::quote == 1 && tok::space == 2, "");
+static_assert(lex::classify('7') == (lex::digit | lex::xdigit
+                                   | lex::alnum | lex::idcont), "");
+static_assert(lex::classify('_') == (lex::punct | lex::idstart
+                                   | lex::idcont), "");
+static_assert(tok::classify('\'') == tok::quote, "");
+static_assert(lex::classify(0x80) == 0 && tok::classify(0xff) == 0, "");
+
+int main()
+{
+  for (unsigned c = 0; c != 256; ++c) {
+    char const ch = static_cast<char>(c);
+    unsigned const b = lex::bits(ch);
+    if (b != lex::table()[c] || b != lex::classify(c))
+      return 1;
+    if (lex::is(ch, lex::digit) != !!std::isdigit(c)
+     || lex::is(ch, lex::xdigit) != !!std::isxdigit(c)
+     || lex::is(ch, lex::upper) != !!std::isupper(c)
+     || lex::is(ch, lex::lower) != !!std::islower(c)
+     || lex::is(ch, lex::alpha) != !!std::isalpha(c)
+     || lex::is(ch, lex::alnum) != !!std::isalnum(c)
+     || lex::is(ch, lex::space) != !!std::isspace(c)
+     || lex::is(ch, lex::punct) != !!std::ispunct(c))
+      return 2;
+    if (lex::is(ch, lex::idstart) != (std::isalpha(c) || c == '_')
+     || lex::is(ch, lex::idcont) != (std::isalnum(c) || c == '_')
+     || lex::is(ch, lex::digit | lex::space)
+        != (std::isdigit(c) || std::isspace(c)))
+      return 3;
+    if (tok::bits(ch) != ((c == '"' || c == '\'') | !!std::isspace(c) << 1))
+      return 4;
+  }
+}
+
+#include "IREPEAT_UNDEF.hpp"
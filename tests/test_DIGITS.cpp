@@ -0,0 +1,121 @@
+#include "IREPEAT.hpp"
+#include "DIGITS.hpp"
+
+#include <cctype>
+#include <cstdio>
+#include <cstring>
+
+/*
+   Tests for DIGITS.hpp integer formatting and parsing.
+
+   The generated tables are checked entry by entry, and encoding and
+   decoding against printf formatting, at each digit length boundary
+   and over a pseudorandom spread of values, in main(), failing with
+   a nonzero exit.
+ */
+
+DIGITS(digits)
+
+// enc<U>(v): v formats as printf "%llu" and "%llx", and parses back
+template <typename U>
+bool enc(U v)
+{
+  char s[24], b[24];
+  unsigned long long u = v;
+  int n = std::snprintf(s, sizeof s, "%llu", u);
+  if (digits::dec_length(v) != unsigned(n)
+   || digits::to_dec(b, v) != b + n || std::memcmp(b, s, n) != 0)
+    return false;
+  U r = 0;
+  if (digits::from_dec(b, b + n, r) != b + n || r != v)
+    return false;
+  n = std::snprintf(s, sizeof s, "%llx", u);
+  if (digits::hex_length(v) != unsigned(n)
+   || digits::to_hex(b, v) != b + n || std::memcmp(b, s, n) != 0)
+    return false;
+  r = 0;
+  return digits::from_hex(b, b + n, r) == b + n && r == v;
+}
+
+// dec<U>(s,end,v): from_dec of s returns s + end, nullptr if end < 0,
+//                  and parses v; hex<U> likewise for from_hex
+template <typename U>
+bool dec(char const* s, int end, U v)
+{
+  U r = 7;
+  char const* p = digits::from_dec(s, s + std::strlen(s), r);
+  return end < 0 ? p == nullptr && r == 7 : p == s + end && r == v;
+}
+template <typename U>
+bool hex(char const* s, int end, U v)
+{
+  U r = 7;
+  char const* p = digits::from_hex(s, s + std::strlen(s), r);
+  return end < 0 ? p == nullptr && r == 7 : p == s + end && r == v;
+}
+
+int main()
+{
+  using u32 = std::uint32_t;
+  using u64 = std::uint64_t;
+
+  for (unsigned i = 0; i != 100; ++i)
+    if (digits::dec_pairs()[2 * i] != char('0' + i / 10)
+     || digits::dec_pairs()[2 * i + 1] != char('0' + i % 10))
+      return 1;
+  for (unsigned i = 0; i != 256; ++i) {
+    char s[4];
+    std::snprintf(s, sizeof s, "%02x", i);
+    if (std::memcmp(digits::hex_pairs() + 2 * i, s, 2) != 0)
+      return 2;
+    char const* hexits = "0123456789abcdef";
+    char const* c = i ? std::strchr(hexits, std::tolower(int(i))) : nullptr;
+    unsigned v = c ? unsigned(c - hexits) : 0xff;
+    if (digits::values()[i] != v)
+      return 3;
+  }
+  if (std::strlen(digits::hex_pairs()) != 512)
+    return 4;
+
+  // each digit length boundary, 9..9 and 10..0, decimal and hex
+  u64 p = 1;
+  for (unsigned n = 1; n != 21; ++n, p *= 10) {
+    if (!enc(p) || !enc(p - 1) || !enc(p + 1))
+      return 5;
+    if (n < 11 && (!enc(u32(p)) || !enc(u32(p - 1)) || !enc(u32(p + 1))))
+      return 6;
+  }
+  for (unsigned s = 0; s != 64; ++s)
+    if (!enc(u64(1) << s) || !enc((u64(1) << s) - 1)
+     || (s < 32 && !enc(u32(1) << s)))
+      return 7;
+  if (!enc(~u64(0)) || !enc(~u32(0)))
+    return 8;
+  u64 x = 88172645463325252u;
+  for (unsigned i = 0; i != 100000; ++i) {
+    x ^= x << 13, x ^= x >> 7, x ^= x << 17; // xorshift64
+    if (!enc(x >> (x & 63)) || !enc(u32(x >> (x & 31))))
+      return 9;
+  }
+
+  // longest prefix of digits, leading zeros, no digits, out of range
+  if (!dec("123x", 3, u32(123)) || !dec("0", 1, u32(0))
+   || !dec("00000000000000000000042", 23, u32(42))
+   || !dec("4294967295", 10, u32(4294967295u))
+   || !dec("4294967296", -1, u32(0)) || !dec("42949672950", -1, u32(0))
+   || !dec("99999999999", -1, u32(0)) || !dec("", -1, u32(0))
+   || !dec("x1", -1, u32(0)) || !dec("-1", -1, u32(0))
+   || !dec("18446744073709551615", 20, ~u64(0))
+   || !dec("18446744073709551616", -1, u64(0))
+   || !dec("99999999999999999999", -1, u64(0)))
+    return 10;
+  if (!hex("fFx", 2, u32(0xff)) || !hex("0x1", 1, u32(0))
+   || !hex("FFFFFFFF", 8, ~u32(0)) || !hex("100000000", -1, u32(0))
+   || !hex("000000000000000000001a", 22, u32(0x1a))
+   || !hex("ffffffffffffffff", 16, ~u64(0))
+   || !hex("10000000000000000", -1, u64(0))
+   || !hex("g", -1, u32(0)) || !hex("", -1, u64(0)))
+    return 11;
+}
+
+#include "IREPEAT_UNDEF.hpp"
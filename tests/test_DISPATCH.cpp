@@ -0,0 +1,58 @@
+#include "IREPEAT.hpp"
+#include "DISPATCH.hpp"
+
+/*
+   Tests for DISPATCH.hpp runtime to compile-time index dispatch.
+
+   The generated dispatchers are checked against the index
+   in main(), failing with a nonzero exit.
+ */
+
+template <unsigned K>
+unsigned kernel(unsigned x) { return K * 1000 + x; }
+
+template <unsigned I, unsigned J>
+unsigned kernel2(unsigned& x) { return x = I * 1000 + J; }
+
+DISPATCH(dispatch1,(1),kernel)
+DISPATCH(dispatch16,(1)(0),kernel)
+DISPATCH(dispatch300,(1)(2)(c),kernel)
+DISPATCH2(dispatch3x5,(3),(5),kernel2)
+DISPATCH2(dispatch16x20,(1)(0),(1)(4),kernel2)
+
+// Counts of more than 4 digits, beyond IREPEAT, fail DISPATCH_CHECK
+static_assert(DISPATCH_FITS((f)(f)(f)(f)) && !DISPATCH_FITS((1)(0)(0)(0)(0))
+           && !DISPATCH_FITS((0)(0)(0)(0)(1)), "");
+
+int main()
+{
+  if (dispatch1::call(0,5) != 5 || dispatch1::jump(0,5) != 5)
+    return 1;
+  if (dispatch1::call(9,5) != 5) // out of range, first index
+    return 2;
+  for (unsigned n = 0; n != 16; ++n)
+    if (dispatch16::call(n,7) != n*1000+7 || dispatch16::jump(n,7) != n*1000+7)
+      return 3;
+  if (dispatch16::call(16,7) != 7) // out of range, first index
+    return 4;
+  for (unsigned n = 0; n != 300; ++n)
+    if (dispatch300::call(n,1) != n*1000+1 || dispatch300::jump(n,1) != n*1000+1)
+      return 5;
+  for (unsigned i = 0; i != 3; ++i)
+    for (unsigned j = 0; j != 5; ++j) {
+      unsigned x = 0, y = 0;
+      if (dispatch3x5::call(i,j,x) != i*1000+j || x != i*1000+j)
+        return 6;
+      if (dispatch3x5::jump(i,j,y) != i*1000+j || y != i*1000+j)
+        return 7;
+    }
+  for (unsigned i = 0; i != 16; ++i)
+    for (unsigned j = 0; j != 20; ++j) {
+      unsigned x = 0;
+      if (dispatch16x20::call(i,j,x) != i*1000+j
+       || dispatch16x20::jump(i,j,x) != i*1000+j)
+        return 8;
+    }
+}
+
+#include "IREPEAT_UNDEF.hpp"
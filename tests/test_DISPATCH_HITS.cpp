@@ -0,0 +1,62 @@
+#define DISPATCH_HITS
+#include "IREPEAT.hpp"
+#include "DISPATCH.hpp"
+
+#include <cstring>
+
+/*
+   Tests for DISPATCH.hpp hit counts, enabled by DISPATCH_HITS.
+
+   Counts and the dumped histogram are checked in main(),
+   failing with a nonzero exit.
+ */
+
+template <unsigned K>
+unsigned kernel(unsigned x) { return K + x; }
+
+template <unsigned I, unsigned J>
+unsigned kernel2(unsigned x) { return I * 100 + J + x; }
+
+DISPATCH(dispatch16,(1)(0),kernel)
+DISPATCH2(dispatch3x4,(3),(4),kernel2)
+
+int main()
+{
+  for (unsigned n = 0; n != 16; ++n)
+    for (unsigned t = 0; t != n; ++t)
+      dispatch16::call(n, 0);
+  dispatch16::jump(5, 0);
+  dispatch16::call(99, 0); // out of range, counted for case 0
+  for (unsigned n = 0; n != 16; ++n)
+    if (dispatch16::hits()[n] != n + (n == 5) + (n == 0))
+      return 1;
+
+  dispatch3x4::call(2, 3, 0);
+  dispatch3x4::call(2, 3, 0);
+  dispatch3x4::jump(2, 1, 0);
+  dispatch3x4::call(0, 0, 0);
+  if (dispatch3x4::hits()[2] != 3 || dispatch3x4::hits()[0] != 1
+   || dispatch3x4::row<2>::hits()[3] != 2
+   || dispatch3x4::row<2>::hits()[1] != 1
+   || dispatch3x4::row<0>::hits()[0] != 1)
+    return 2;
+
+  char buf[4096] {};
+  std::FILE* f = std::tmpfile();
+  if (!f)
+    return 3;
+  dispatch16::dump(f);
+  dispatch3x4::dump(f);
+  std::rewind(f);
+  std::size_t len = std::fread(buf, 1, sizeof buf - 1, f);
+  std::fclose(f);
+  char const head[] = "dispatch16 hits: 122, 0 of 16 cases not hit\n"
+                      "      15             15  12.30%\n";
+  if (len == 0 || std::strncmp(buf, head, sizeof head - 1) != 0
+   || !std::strstr(buf, "dispatch3x4 row 2 hits: 3, 2 of 4 cases not hit\n"
+                        "       3              2  66.67%\n")
+   || !std::strstr(buf, "dispatch3x4 row 1 hits: 0, 4 of 4 cases not hit\n"))
+    return 4;
+}
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,51 @@
+#include "IREPEAT.hpp"
+#include "DUFF.hpp"
+
+/*
+   Tests for DUFF.hpp Duff's device generator.
+
+   Duff's device is a switch into a loop, not C++11 constexpr,
+   so these checks run in main() and fail with a nonzero exit.
+ */
+
+#define COUNT() ++count;
+
+// duffN(n): number of B() statements run by a U-way DUFF with trip count n
+#define DUFF_COUNT(NAME,U) \
+unsigned NAME(unsigned n) { unsigned count = 0; DUFF(U,n,COUNT); return count; }
+
+DUFF_COUNT(duff1,(1))
+DUFF_COUNT(duff4,(4))
+DUFF_COUNT(duff16,(1)(0))
+DUFF_COUNT(duff32,(2)(0))
+
+#define COPY() *d++ = *s++;
+
+// copy16(d,s,n): 16-way DUFF copy, must preserve element order
+void copy16(int* d, int const* s, unsigned n) { DUFF((1)(0),n,COPY); }
+
+int main()
+{
+  for (unsigned n = 0; n != 100; ++n)
+    if (duff1(n) != n || duff4(n) != n || duff16(n) != n || duff32(n) != n)
+      return 1;
+
+  int src[70], dst[71];
+  for (int i = 0; i != 70; ++i) src[i] = i;
+
+  for (unsigned n = 0; n != 70; ++n) {
+    dst[n] = -1;
+    copy16(dst, src, n);
+    for (unsigned i = 0; i != n; ++i)
+      if (dst[i] != src[i])
+        return 2;
+    if (dst[n] != -1)
+      return 3;
+  }
+}
+
+#undef COUNT
+#undef DUFF_COUNT
+#undef COPY
+
+#include "IREPEAT_UNDEF.hpp"
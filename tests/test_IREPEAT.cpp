@@ -65,6 +65,30 @@ CHECK(
   HEXLIT((0)(1)(2)(3)(4)(5)(6)(7)(8)(9)(a)(b)(c)(d)(e)(f)) == 0x123456789abcdef
 );
 
+// Exact width variants of 1 to 4 digits
+CHECKSTR( SEQCAT1((a)), "a" );
+CHECKSTR( SEQCAT2((0)(a)), "0a" );
+CHECKSTR( SEQCAT3((0)(0)(a)), "00a" );
+CHECKSTR( SEQCAT4((1)(2)(3)(4)), "1234" );
+
+CHECKSTR( RMLZCAT1((0)), "0" );
+CHECKSTR( RMLZCAT2((0)(0)), "0" );
+CHECKSTR( RMLZCAT2((1)(0)), "10" );
+CHECKSTR( RMLZCAT3((0)(2)(0)), "20" );
+CHECKSTR( RMLZCAT4((0)(0)(0)(f)), "f" );
+CHECKSTR( RMLZCAT4((0)(0)(0)(0)), "0" );
+CHECKSTR( RMLZCAT4((0)(1)(0)(0)), "100" );
+CHECKSTR( RMLZCAT4((f)(0)(0)(0)), "f000" );
+
+CHECKSTR( xD4((0)(0)(1)(2)) XD3((0)(0)(0)), "x12 X0" );
+CHECKSTR( x0D4((0)(0)(1)(2)) X0D2((0)(0)), "x0012 X00" );
+
+CHECK( HEXLIT1((f)) == 0xf && HEXLIT2((f)(e)) == 0xfe );
+CHECK( HEXLIT3((0)(0)(1)) == 1 && HEXLIT4((c)(a)(f)(e)) == 0xcafe );
+
+// LENCAT selects the variant for the width of a repeat count
+CHECKSTR( LENCAT(HEXLIT,(1)(0)(0)), "HEXLIT3" );
+
 }
 
 TEST_CASE("Horizontal REPEAT") {
@@ -88,6 +112,10 @@ CHECK(is_iota<0x10>(uchars{XREPEAT((1)(0),HEXLIT,COMMA)}));
 CHECK(is_iota<0xff>(uchars{XREPEAT((f)(f),HEXLIT,COMMA)}));
 CHECK(is_iota<0x100>(uchars{XREPEAT((1)(0)(0),HEXLIT,COMMA)}));
 CHECK(is_iota<0x100>(u16s{IREPEAT((f)(f),HEXLIT,COMMA)}));
+CHECK(is_iota<0x100>(u16s{IREPEAT((f)(f),LENCAT(HEXLIT,(f)(f)),COMMA)}));
+CHECKSTR( XREPEAT((0)(3),LENCAT(x0D,(0)(3)),DOT), "x00.x01.x02");
+CHECKSTR( XREPEAT((1)(2),LENCAT(xD,(1)(2)),DOT),
+          "x0.x1.x2.x3.x4.x5.x6.x7.x8.x9.xa.xb.xc.xd.xe.xf.x10.x11");
 
 // This check is too big for the C++11 is_iota constexpr eval
 //CHECK(is_iota<0xfff>(u16s{XREPEAT((f)(f)(f),HEXLIT,COMMA)}));
@@ -99,6 +127,34 @@ CHECK(sizeof(uchars{XREPEAT((1)(2)(3)(4),ZERO,COMMA)}) == 0x1234);
 
 }
 
+TEST_CASE("Block REPEAT") {
+
+// BREPEAT calls M(H,L) for each block of up to 16 indices H(0)...H(L)
+#define HL(H,L) H|L
+CHECKSTR( BREPEAT((7),HL,DOT), "|(7)");
+CHECKSTR( BREPEAT((1)(0),HL,DOT), "(0)|(f).(1)|(0)");
+CHECKSTR( BREPEAT((2)(7),HL,DOT), "(0)|(f).(1)|(f).(2)|(7)");
+CHECKSTR( BREPEAT((0)(0)(2)(3),HL,NOSEP),
+          "(0)(0)(0)|(f)(0)(0)(1)|(f)(0)(0)(2)|(3)");
+
+// One call per block; 0x1234 + 1 indices in 0x123 + 1 blocks
+#define BZERO(H,L) 0
+CHECK(sizeof(uchars{BREPEAT((1)(2)(3)(4),BZERO,COMMA)}) == 0x124);
+
+// M can itself IREPEAT over the block's low digits
+#define ROW(H,L) {IREPEAT(L,HEXLIT,COMMA)}
+struct rows { unsigned char r0[16], r1[16], r2[8]; };
+constexpr rows rows27{BREPEAT((2)(7),ROW,COMMA)};
+
+CHECK(is_iota<16>(rows27.r0));
+CHECK(is_iota<16>(rows27.r1));
+CHECK(is_iota<8>(rows27.r2));
+
+#undef HL
+#undef BZERO
+#undef ROW
+}
+
 TEST_CASE("Nested REPEAT") {
 /*
   Vertical repetition of horizontal expansion is a good way to nest;
@@ -0,0 +1,86 @@
+#include "IREPEATx100.hpp"
+
+/*
+   Tests for IREPEATx100.hpp, the 1 and 2 digit subset of IREPEAT.hpp
+ */
+
+#define DOT().
+
+#define TEST_CASE(...) namespace test
+#define CHECK(...) static_assert(__VA_ARGS__,"")
+#define CHECKSTR(C,S) CHECK(c_str_cmp(STR(C),S))
+
+int main() {}
+
+// c_str_cmp(cstra,cstrb): C++11 constexpr C string compare, tail recurse.
+constexpr bool c_str_cmp(const char* a, const char* b)
+{
+  return (*a == *b && (*a == 0 || c_str_cmp(a+1,b+1)));
+}
+
+// is_iota(array): C++11 constexpr test if array is index sequence 0,1,...
+template <unsigned N,typename T>
+constexpr bool is_iota(T const(&a)[N], unsigned i=0)
+{
+  return a[i]-i==0 && (i+1==N || is_iota(static_cast<T const(&)[N]>(a),i+1));
+}
+
+TEST_CASE("CATS") {
+
+CHECKSTR(
+  SEQCAT((0)(1)(2)(3)(4)(5)(6)(7)(8)(9)(a)(b)(c)(d)(e)(f)), "0123456789abcdef"
+);
+CHECKSTR( RMLZCAT((0)(0)(0)(HELLO)), "HELLO" );
+CHECKSTR( xD((0)(7)), "x7" );
+CHECKSTR( x0D((0)(7)), "x07" );
+CHECK( HEXLIT((f)(f)) == 0xff );
+
+}
+
+TEST_CASE("Decrement") {
+
+// XREPEAT is IREPEAT of the decremented count; empty for zero
+CHECKSTR( DECZ((0)), "" );
+CHECKSTR( DECZ((1)), "(0)" );
+CHECKSTR( DECZ((f)), "(e)" );
+CHECKSTR( DECZ((0)(0)), "" );
+CHECKSTR( DECZ((0)(1)), "(0)(0)" );
+CHECKSTR( DECZ((1)(0)), "(0)(f)" );
+CHECKSTR( DECZ((2)(0)), "(1)(f)" );
+CHECKSTR( DECZ((f)(f)), "(f)(e)" );
+
+}
+
+TEST_CASE("Horizontal REPEAT") {
+
+CHECKSTR( XREPEAT((0),WhAtEvEr,COMMA), "");
+CHECKSTR( XREPEAT((0)(0),WhAtEvEr,COMMA), "");
+CHECKSTR( XREPEAT((1),SEQCAT,COMMA), "0");
+CHECKSTR( IREPEAT((0),SEQCAT,COMMA), "0");
+
+CHECKSTR( XREPEAT((8),SEQCAT,DOT), "0.1.2.3.4.5.6.7");
+CHECKSTR( IREPEAT((f),SEQCAT,NOSEP), "0123456789abcdef");
+CHECKSTR( XREPEAT((1)(0),RMLZCAT,DOT), "0.1.2.3.4.5.6.7.8.9.a.b.c.d.e.f");
+CHECKSTR( XREPEAT((0)(3),x0D,DOT), "x00.x01.x02");
+
+using uchars = unsigned char[];
+using u16s = unsigned short[];
+
+CHECK(is_iota<0x10>(uchars{XREPEAT((1)(0),HEXLIT,COMMA)}));
+CHECK(is_iota<0x20>(uchars{XREPEAT((2)(0),HEXLIT,COMMA)}));
+CHECK(is_iota<0xff>(uchars{XREPEAT((f)(f),HEXLIT,COMMA)}));
+CHECK(is_iota<0x100>(u16s{IREPEAT((f)(f),HEXLIT,COMMA)}));
+
+}
+
+// IREPEAT.hpp supersedes the subset, extending to 4 digits
+#include "IREPEAT.hpp"
+
+TEST_CASE("Superseded") {
+
+CHECK(is_iota<0x123>(u16s{XREPEAT((1)(2)(3),HEXLIT,COMMA)}));
+CHECKSTR( XREPEAT((1)(0),RMLZCAT,DOT), "0.1.2.3.4.5.6.7.8.9.a.b.c.d.e.f");
+
+}
+
+#include "IREPEAT_UNDEF.hpp"
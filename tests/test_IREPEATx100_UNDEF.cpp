@@ -0,0 +1,35 @@
+/*
+   Tests for IREPEATx100_UNDEF.hpp alongside IREPEAT.hpp
+
+   IREPEATx100.hpp included after IREPEAT.hpp defines nothing, so its
+   UNDEF must undefine nothing, leaving IREPEAT.hpp's macros in place.
+   Included alone, the subset is undefined and IREPEAT.hpp can follow.
+ */
+
+#define CHECK(...) static_assert(__VA_ARGS__,"")
+
+#include "IREPEAT.hpp"
+#include "IREPEATx100.hpp"
+#include "IREPEATx100_UNDEF.hpp"
+
+CHECK(HEXLIT((f)(f)(f)(f)) == 0xffff);
+
+#include "IREPEAT_UNDEF.hpp"
+
+#include "IREPEATx100.hpp"
+#include "IREPEATx100_UNDEF.hpp"
+
+#if defined(HEXLIT) || defined(IREPEAT) || defined(IREPEATx100_HPP)
+#error "IREPEATx100_UNDEF.hpp left subset macros defined"
+#endif
+
+#include "IREPEAT.hpp"
+
+constexpr int iota[] {XREPEAT((2)(5),HEXLIT,COMMA)};
+CHECK(sizeof iota / sizeof *iota == 0x25 && iota[0x24] == 0x24);
+
+int main() {}
+
+#undef CHECK
+
+#include "IREPEAT_UNDEF.hpp"
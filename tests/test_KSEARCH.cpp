@@ -0,0 +1,57 @@
+#include "IREPEAT.hpp"
+#include "KSEARCH.hpp"
+
+#include <algorithm>
+
+/*
+   Tests for KSEARCH.hpp constant key search generators.
+
+   The generated searches are checked against std::lower_bound
+   in main(), failing with a nonzero exit.
+ */
+
+// Odd keys 1,3,5,... leave a miss between each pair of hits
+#define ODD(H) 2*HEXLIT(H)+1
+
+KSEARCH(ksearch1,int,(1),ODD)
+KSEARCH(ksearch2,int,(2),ODD)
+KSEARCH(ksearch3,int,(3),ODD)
+KSEARCH(ksearch7,int,(7),ODD)
+KSEARCH(ksearch16,int,(1)(0),ODD)
+KSEARCH(ksearch100,int,(6)(4),ODD)
+KSEARCH(ksearch256,int,(1)(0)(0),ODD)
+
+KRANK(krank1,int,(1),ODD)
+KRANK(krank7,int,(7),ODD)
+KRANK(krank16,int,(1)(0),ODD)
+KRANK(krank100,int,(6)(4),ODD)
+
+constexpr int odds[] {XREPEAT((1)(0)(0),ODD,COMMA)};
+
+unsigned lower_bound(unsigned n, int x)
+{
+  return static_cast<unsigned>(std::lower_bound(odds, odds + n, x) - odds);
+}
+
+int main()
+{
+  for (int x = -2; x != 520; ++x) {
+    if (ksearch1(x) != lower_bound(1,x) || krank1(x) != lower_bound(1,x))
+      return 1;
+    if (ksearch2(x) != lower_bound(2,x) || ksearch3(x) != lower_bound(3,x))
+      return 6;
+    if (ksearch7(x) != lower_bound(7,x) || krank7(x) != lower_bound(7,x))
+      return 2;
+    if (ksearch16(x) != lower_bound(16,x) || krank16(x) != lower_bound(16,x))
+      return 3;
+    if (ksearch100(x) != lower_bound(100,x)
+     || krank100(x) != lower_bound(100,x))
+      return 4;
+    if (ksearch256(x) != lower_bound(256,x))
+      return 5;
+  }
+}
+
+#undef ODD
+
+#include "IREPEAT_UNDEF.hpp"
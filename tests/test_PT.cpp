@@ -0,0 +1,115 @@
+#include "IREPEAT.hpp"
+#include "PT.hpp"
+
+/*
+   Tests for PT.hpp stackless coroutines.
+
+   Coroutines are stepped in main() and their outputs and states
+   checked, failing with a nonzero exit. Index sizes and the dense
+   numbering of resume points are checked by static_assert.
+ */
+
+// counter: yields 0, 1, 2 in c.out, then ends
+struct counter { PT_STATE((4)); unsigned i, out; };
+
+bool count3(counter& c)
+{
+  PT_BEGIN(c)
+  for (c.i = 0; c.i != 3; ++c.i) {
+    c.out = c.i;
+    PT_YIELD();
+  }
+  PT_END()
+}
+
+// framer: reads length-prefixed frames byte by byte, summing each
+struct framer { PT_STATE((8)); unsigned left, sum, frames; };
+
+bool frame(framer& f, unsigned char b)
+{
+  PT_BEGIN(f)
+  for (;;) {
+    PT_AWAIT(b != 0); // skip zero padding before a length
+    f.left = b;
+    f.sum = 0;
+    while (f.left != 0) {
+      PT_YIELD();
+      f.sum += b;
+      --f.left;
+    }
+    if (f.sum == 0xff)
+      PT_EXIT();
+    ++f.frames;
+    PT_YIELD();
+  }
+  PT_END()
+}
+
+// restarter: two steps then restarts, counting passes
+struct restarter { PT_STATE((1)); unsigned passes; };
+
+bool restart(restarter& r)
+{
+  PT_BEGIN(r)
+  ++r.passes;
+  PT_YIELD();
+  PT_RESTART();
+  PT_END()
+}
+
+// dense: resume points numbered 1, 2, 3 store their index
+struct dense { PT_STATE((3)); };
+
+bool resume3(dense& d)
+{
+  PT_BEGIN(d)
+  PT_YIELD();
+  PT_YIELD();
+  PT_YIELD();
+  PT_END()
+}
+
+// wide: a 255 resume point limit needs a 16-bit index
+struct wide { PT_STATE((f)(f)); };
+
+static_assert(sizeof(counter::pt_resume) == 1, "");
+static_assert(sizeof(wide::pt_resume) == 2, "");
+static_assert(sizeof(dense) == 1, "");
+
+int main()
+{
+  counter c {};
+  unsigned out[3] {}, n = 0;
+  while (count3(c))
+    out[n++] = c.out;
+  if (n != 3 || out[0] != 0 || out[1] != 1 || out[2] != 2)
+    return 1;
+  if (count3(c) || c.pt_resume != 5) // ended, index N + 1
+    return 2;
+
+  framer f {};
+  unsigned char const in[] {0, 2, 5, 6, 0, 0, 1, 9, 3, 1, 2, 3, 2, 0xf0, 0xf};
+  unsigned i = 0;
+  while (i != sizeof in && frame(f, in[i]))
+    ++i;
+  if (f.frames != 3 || i != sizeof in - 1 || f.sum != 0xff)
+    return 3;
+  if (frame(f, 1))
+    return 4;
+
+  restarter r {};
+  for (int k = 0; k != 6; ++k)
+    if (!restart(r))
+      return 5;
+  if (r.passes != 3)
+    return 6;
+
+  dense d {};
+  for (unsigned k = 1; k != 4; ++k)
+    if (!resume3(d) || d.pt_resume != k)
+      return 7;
+  if (resume3(d) || d.pt_resume != 4)
+    return 8;
+}
+
+#include "IREPEAT_UNDEF.hpp"
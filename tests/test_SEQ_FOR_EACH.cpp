@@ -0,0 +1,91 @@
+#include "IREPEAT.hpp"
+#include "SEQ_FOR_EACH.hpp"
+
+/*
+   Tests for SEQ_FOR_EACH.hpp indexed sequence iteration.
+
+   Short expansions are checked as strings by static_assert.
+   Long sequences, generated by IREPEAT, are checked in main()
+   element by element against their index, failing with a nonzero
+   exit, at each side of the level boundaries 16, 256 and 4096;
+   4097 elements take all four levels.
+ */
+
+#define CHECK(...) static_assert(__VA_ARGS__,"")
+#define CHECKSTR(C,S) CHECK(c_str_cmp(STR(C),S))
+
+// c_str_cmp(cstra,cstrb): C++11 constexpr C string compare, tail recurse.
+constexpr bool c_str_cmp(const char* a, const char* b)
+{
+  return (*a == *b && (*a == 0 || c_str_cmp(a+1,b+1)));
+}
+
+#define DOT().
+#define HE(H,E) H:E
+#define IDX(H,E) SEQCAT(H)
+
+CHECKSTR( SEQ_FOR_EACH_I(,HE,COMMA), "");
+CHECKSTR( SEQ_FOR_EACH_I((a),HE,COMMA), "(0):a");
+CHECKSTR( SEQ_FOR_EACH_I((a)(b)(c),HE,DOT), "(0):a.(1):b.(2):c");
+CHECKSTR( SEQ_FOR_EACH_I((a)((b,c))(),HE,DOT), "(0):a.(1):(b,c).(2):");
+
+// 16 elements take one digit, 17 take two
+CHECKSTR( SEQ_FOR_EACH_I((0)(1)(2)(3)(4)(5)(6)(7)(8)(9)(a)(b)(c)(d)(e)(f),
+                         IDX,NOSEP), "0123456789abcdef");
+CHECKSTR( SEQ_FOR_EACH_I((0)(1)(2)(3)(4)(5)(6)(7)(8)(9)(a)(b)(c)(d)(e)(f)(g),
+                         HE,NOSEP),
+ "(0)(0):0(0)(1):1(0)(2):2(0)(3):3(0)(4):4(0)(5):5(0)(6):6(0)(7):7"
+ "(0)(8):8(0)(9):9(0)(a):a(0)(b):b(0)(c):c(0)(d):d(0)(e):e(0)(f):f(1)(0):g");
+
+// ELEM(H): sequence element (H), as a hex literal
+#define ELEM(H) (HEXLIT(H))
+// DIFF(H,E): element less its index, expected 0
+#define DIFF(H,E) E - HEXLIT(H)
+#define WIDTH(H,E) LEN(H)
+
+unsigned const diff16[] {SEQ_FOR_EACH_I(IREPEAT((f),ELEM,NOSEP),DIFF,COMMA)};
+unsigned const diff17[] {SEQ_FOR_EACH_I(IREPEAT((1)(0),ELEM,NOSEP),DIFF,COMMA)};
+unsigned const diff256[] {SEQ_FOR_EACH_I(IREPEAT((f)(f),ELEM,NOSEP),DIFF,COMMA)};
+unsigned const diff257[] {SEQ_FOR_EACH_I(IREPEAT((1)(0)(0),ELEM,NOSEP),DIFF,COMMA)};
+unsigned const diff4096[]
+{SEQ_FOR_EACH_I(IREPEAT((f)(f)(f),ELEM,NOSEP),DIFF,COMMA)};
+unsigned const diff4097[]
+{SEQ_FOR_EACH_I(IREPEAT((1)(0)(0)(0),ELEM,NOSEP),DIFF,COMMA)};
+unsigned const width4097[]
+{SEQ_FOR_EACH_I(IREPEAT((1)(0)(0)(0),ELEM,NOSEP),WIDTH,COMMA)};
+
+CHECK(sizeof diff16 / sizeof *diff16 == 16);
+CHECK(sizeof diff17 / sizeof *diff17 == 17);
+CHECK(sizeof diff256 / sizeof *diff256 == 256);
+CHECK(sizeof diff257 / sizeof *diff257 == 257);
+CHECK(sizeof diff4096 / sizeof *diff4096 == 4096);
+CHECK(sizeof diff4097 / sizeof *diff4097 == 4097);
+
+// zeros(a): all elements of a are 0
+template <unsigned N>
+bool zeros(unsigned const (&a)[N])
+{
+  for (unsigned i = 0; i != N; ++i)
+    if (a[i] != 0)
+      return false;
+  return true;
+}
+
+int main()
+{
+  if (!zeros(diff16) || !zeros(diff17) || !zeros(diff256)
+   || !zeros(diff257) || !zeros(diff4096) || !zeros(diff4097))
+    return 1;
+  for (unsigned w : width4097)
+    if (w != 4)
+      return 2;
+}
+
+#undef DOT
+#undef HE
+#undef IDX
+#undef ELEM
+#undef DIFF
+#undef WIDTH
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,45 @@
+#include "IREPEAT.hpp"
+#include "SHARDS.hpp"
+
+#include <atomic>
+#include <cstddef>
+
+/*
+   Tests for SHARDS.hpp cache line padded slot generator.
+
+   Layout is checked by static_assert, slot access and sum
+   in main(), failing with a nonzero exit.
+ */
+
+SHARDS(shards1,int,(1))
+SHARDS(shards16,long,(1)(0))
+SHARDS(counters,std::atomic<unsigned long>,(8))
+
+static_assert(shards1::size == 1 && sizeof(shards1) == 64, "");
+static_assert(shards16::size == 16 && sizeof(shards16) == 16 * 64, "");
+static_assert(offsetof(shards16, x0f) == 15 * 64, "");
+static_assert(sizeof(counters) == 8 * 64, "");
+
+int main()
+{
+  shards1 s1 {};
+  s1[0] = 5;
+  if (s1.x0 != 5 || s1.sum() != 5)
+    return 1;
+
+  shards16 s16 {};
+  for (unsigned i = 0; i != shards16::size; ++i)
+    s16[i] = i + 1;
+  shards16 const& cs16 = s16;
+  if (s16.x00 != 1 || s16.x0a != 11 || cs16[15] != 16 || cs16.sum() != 136)
+    return 2;
+
+  static counters c;
+  for (unsigned i = 0; i != counters::size; ++i)
+    c[i].fetch_add(i, std::memory_order_relaxed);
+  c.x7 += 100;
+  if (c.sum() != 128)
+    return 3;
+}
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,79 @@
+#include "IREPEAT.hpp"
+#include "SOA.hpp"
+
+#include <cstdint>
+
+/*
+   Tests for SOA.hpp structure of arrays generator.
+
+   Layout is checked by static_assert, element access, copy
+   and swap in main(), failing with a nonzero exit.
+ */
+
+#define PARTICLE(H) CAT(PARTICLE_,SEQCAT(H))
+#define PARTICLE_0 (float,x)
+#define PARTICLE_1 (float,y)
+#define PARTICLE_2 (char,tag)
+#define PARTICLE_3 (unsigned,id)
+
+SOA(particles,(4),PARTICLE,(1)(0)(0))
+
+// 17 fields to check two digit field indices
+#define FIELD(H) (short,x0D(H))
+
+SOA(fields17,(1)(1),FIELD,(3))
+
+static_assert(particles::capacity == 256, "");
+static_assert(alignof(particles) == 64, "");
+static_assert(sizeof(particles) == 256 * (4 + 4 + 1 + 4), "");
+static_assert(sizeof(fields17) == 17 * 64, "");
+
+particles soa;
+fields17 f17;
+
+bool aligned(void const* p)
+{
+  return reinterpret_cast<std::uintptr_t>(p) % 64 == 0;
+}
+
+int main()
+{
+  if (!aligned(soa.x) || !aligned(soa.y) || !aligned(soa.tag)
+   || !aligned(soa.id) || !aligned(f17.x0f) || !aligned(f17.x10))
+    return 1;
+
+  for (unsigned i = 0; i != particles::capacity; ++i) {
+    particles::row r = soa[i];
+    r.x = float(i); r.y = -float(i); r.tag = char(i); r.id = i * 10;
+  }
+  particles const& csoa = soa;
+  for (unsigned i = 0; i != particles::capacity; ++i) {
+    particles::const_row r = csoa[i];
+    if (r.x != float(i) || soa.y[i] != -float(i) || r.id != i * 10)
+      return 2;
+  }
+
+  soa.copy(3, 200);
+  if (soa.x[3] != 200 || soa.y[3] != -200 || soa[3].tag != char(200)
+   || soa.id[3] != 2000 || soa.x[200] != 200)
+    return 3;
+
+  soa.swap(1, 2);
+  if (soa[1].x != 2 || soa[2].x != 1 || soa.id[1] != 20 || soa.id[2] != 10)
+    return 4;
+
+  f17[2].x10 = 7;
+  f17.copy(0, 2);
+  f17.swap(0, 1);
+  if (f17.x10[1] != 7 || f17[0].x10 != 0)
+    return 5;
+}
+
+#undef PARTICLE
+#undef PARTICLE_0
+#undef PARTICLE_1
+#undef PARTICLE_2
+#undef PARTICLE_3
+#undef FIELD
+
+#include "IREPEAT_UNDEF.hpp"
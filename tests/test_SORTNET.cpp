@@ -0,0 +1,91 @@
+#include "IREPEAT.hpp"
+#include "SORTNET.hpp"
+
+#include <algorithm>
+#include <random>
+
+/*
+   Tests for SORTNET.hpp sorting network generator.
+
+   Networks are checked on all 0-1 inputs up to 16 elements,
+   which suffices by the 0-1 principle, and on random inputs
+   against std::sort in main(), failing with a nonzero exit.
+ */
+
+SORTNET(sort1,int,(1))
+SORTNET(sort2,int,(2))
+SORTNET(sort3,int,(3))
+SORTNET(sort4,int,(4))
+SORTNET(sort7,int,(7))
+SORTNET(sort8,int,(8))
+SORTNET(sort13,int,(d))
+SORTNET(sort16,int,(1)(0))
+SORTNET(sort17,int,(1)(1))
+SORTNET(sort32,int,(2)(0))
+SORTNET(sort47,int,(2)(f))
+SORTNET(sort64,int,(4)(0))
+
+// counted: an int whose operator< counts comparisons
+struct counted { int v; };
+unsigned compares = 0;
+bool operator<(counted a, counted b) { return ++compares, a.v < b.v; }
+
+SORTNET(sort4c,counted,(4))
+SORTNET(sort8c,counted,(8))
+SORTNET(sort16c,counted,(1)(0))
+SORTNET(sort32c,counted,(2)(0))
+
+// zero_one(sort,n): sort all 2^n 0-1 inputs of length n
+bool zero_one(void (*sort)(int*), unsigned n)
+{
+  for (unsigned bits = 0; bits != 1u << n; ++bits) {
+    int a[16];
+    for (unsigned i = 0; i != n; ++i) a[i] = bits >> i & 1;
+    sort(a);
+    if (!std::is_sorted(a, a + n))
+      return false;
+  }
+  return true;
+}
+
+// random(sort,n): sort random inputs of length n, compare with std::sort
+bool random(void (*sort)(int*), unsigned n)
+{
+  static std::mt19937 rng(42);
+  for (int t = 0; t != 1000; ++t) {
+    int a[64], b[64];
+    for (unsigned i = 0; i != n; ++i) a[i] = b[i] = int(rng() % 100);
+    sort(a);
+    std::sort(b, b + n);
+    if (!std::equal(a, a + n, b))
+      return false;
+  }
+  return true;
+}
+
+// comparators(sort,n): count compare-exchanges, each two operator<
+template <unsigned N>
+unsigned comparators(void (*sort)(counted*))
+{
+  counted a[N] {};
+  compares = 0;
+  sort(a);
+  return compares / 2;
+}
+
+int main()
+{
+  if (!zero_one(sort1,1) || !zero_one(sort2,2) || !zero_one(sort3,3)
+   || !zero_one(sort4,4) || !zero_one(sort7,7) || !zero_one(sort8,8)
+   || !zero_one(sort13,13) || !zero_one(sort16,16))
+    return 1;
+  if (!random(sort17,17) || !random(sort32,32)
+   || !random(sort47,47) || !random(sort64,64))
+    return 2;
+  // Batcher's odd-even merge sort comparator counts
+  if (comparators<4>(sort4c) != 5 || comparators<8>(sort8c) != 19
+   || comparators<16>(sort16c) != 63 || comparators<32>(sort32c) != 191)
+    return 3;
+}
+
+#include "IREPEAT_UNDEF.hpp"
@@ -0,0 +1,74 @@
+#include "IREPEAT.hpp"
+#include "SPSC.hpp"
+
+#include <thread>
+
+/*
+   Tests for SPSC.hpp single-producer single-consumer ring buffer.
+
+   Full and empty, all or none batches and index wraparound are
+   checked on one thread, then order and count of a transfer between
+   a producer and a consumer thread, in main(), failing with a
+   nonzero exit.
+ */
+
+SPSC(ring8,int,(8))
+SPSC(ring64,unsigned,(4)(0))
+
+static_assert(ring8::capacity == 8 && ring64::capacity == 64, "");
+static_assert(alignof(ring8) == 64, "");
+
+ring8 r8;
+ring64 r64;
+
+int main()
+{
+  int in[8] = {1, 2, 3, 4, 5, 6, 7, 8}, out[8] = {};
+  int v = 0;
+  if (r8.pop(v) || !r8.push_n<3>(in) || r8.push_n<6>(in)
+   || !r8.push_n<5>(in + 3) || r8.push(9))
+    return 1;
+  if (!r8.pop_n<8>(out) || r8.pop(v))
+    return 2;
+  for (int i = 0; i != 8; ++i)
+    if (out[i] != i + 1)
+      return 3;
+
+  // wraparound: runs of 3 through a ring of 8, from each start index
+  for (int i = 0; i != 100; ++i) {
+    int const run[3] = {i, i + 1, i + 2};
+    int got[3] = {};
+    if (!r8.push_n<3>(run) || !r8.pop_n<1>(got) || !r8.pop_n<2>(got + 1)
+     || got[0] != i || got[1] != i + 1 || got[2] != i + 2)
+      return 4;
+  }
+
+  // 35 * 2^15 values in batches of 7 to a consumer in batches of 5
+  unsigned const n = 7 * 5 << 15;
+  bool in_order = true;
+  std::thread consumer([n,&in_order] {
+    unsigned got[5];
+    for (unsigned next = 0; next != n; ) {
+      if (!r64.pop_n<5>(got)) {
+        std::this_thread::yield();
+        continue;
+      }
+      for (unsigned x : got)
+        in_order &= x == next++;
+    }
+  });
+  unsigned batch[7];
+  for (unsigned next = 0; next != n; ) {
+    for (unsigned& x : batch) x = next + unsigned(&x - batch);
+    if (r64.push_n<7>(batch))
+      next += 7;
+    else
+      std::this_thread::yield();
+  }
+  consumer.join();
+  unsigned x;
+  if (!in_order || r64.pop(x))
+    return 5;
+}
+
+#include "IREPEAT_UNDEF.hpp"
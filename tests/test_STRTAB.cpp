@@ -0,0 +1,69 @@
+#include "IREPEAT.hpp"
+#include "STRTAB.hpp"
+
+#include <cstring>
+
+/*
+   Tests for STRTAB.hpp string table generator.
+
+   Tables of names of varying length are checked string by string
+   against the names formatted at runtime, in main(), failing with
+   a nonzero exit.
+ */
+
+// NAME(H): "x" followed by H in hex, with no leading zeros
+#define NAME(H) STR(xD(H))
+// EMPTY(H): every string empty
+#define EMPTY(H) ""
+
+STRTAB(one,(1),NAME)
+STRTAB(names,(1)(0)(0),NAME)
+STRTAB(empties,(1)(0),EMPTY)
+
+static_assert(names::count == 256, "");
+
+// check<T>(n): T holds "x0" to "x<n-1>" in lowercase hex
+template <typename T>
+bool check(unsigned n)
+{
+  char const* b = T::blob();
+  for (unsigned i = 0; i != n; ++i) {
+    char s[8];
+    std::size_t len = 1;
+    s[0] = 'x';
+    for (unsigned d = i >= 16 ? 16 : 1; d; d /= 16)
+      s[len++] = "0123456789abcdef"[i / d % 16];
+    s[len] = 0;
+    if (std::strcmp(T::c_str(i), s) != 0 || T::length(i) != len
+     || T::c_str(i) != b + T::offset(i) || T::offset(i + 1) <= T::offset(i))
+      return false;
+#if __cplusplus >= 201703L
+    if (T::view(i) != s)
+      return false;
+#endif
+  }
+  return T::offset(n) == T::offset(n - 1) + T::length(n - 1) + 1;
+}
+
+int main()
+{
+  if (one::count != 1 || !check<one>(1))
+    return 1;
+  if (!check<names>(256))
+    return 2;
+  // the blob is the strings end to end, each null terminated
+  if (std::memcmp(names::blob(), "x0\0x1\0x2", 9) != 0
+   || std::memcmp(names::c_str(0xfe), "xfe\0xff", 8) != 0)
+    return 3;
+  for (unsigned i = 0; i != 16; ++i)
+    if (empties::length(i) != 0 || empties::offset(i) != i
+     || *empties::c_str(i) != 0)
+      return 4;
+  if (empties::offset(16) != 16)
+    return 5;
+}
+
+#undef NAME
+#undef EMPTY
+
+#include "IREPEAT_UNDEF.hpp"
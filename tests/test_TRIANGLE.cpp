@@ -0,0 +1,56 @@
+#include "IREPEAT.hpp"
+#include "TRIANGLE.hpp"
+
+#include <cstring>
+
+/*
+   Tests for TRIANGLE.hpp row by row prefix expansion.
+
+   Triangles of arrays and of strings are checked against their
+   expected elements and lengths, row by row, in main(), failing
+   with a nonzero exit.
+ */
+
+// Row H as array t_H of its elements, 0 to H, H two digits wide
+#define ROW(H,...) int const CAT(t_,SEQCAT(H))[] = {__VA_ARGS__};
+TRIANGLE((1)(2),HEXLIT,COMMA,ROW,NOSEP)
+
+// Row H as {H+1, elements}, in one array of rows; a single row
+#define LROW(H,...) {HEXLIT(H) + 1, __VA_ARGS__}
+int const rows[][0x14] = {TRIANGLE((1)(2),HEXLIT,COMMA,LROW,COMMA)};
+int const one[][2] = {TRIANGLE((0),HEXLIT,COMMA,LROW,COMMA)};
+
+// Row H as a string of its element digits, rows separated by '|'
+#define DIGIT(H) STR(SEQCAT(H))
+#define SROW(H,...) __VA_ARGS__
+#define BAR() "|"
+char const digits[] = TRIANGLE((3),DIGIT,NOSEP,SROW,BAR);
+
+// is_iota(a,n): a holds 0 to n-1
+bool is_iota(int const* a, int n)
+{
+  for (int i = 0; i != n; ++i)
+    if (a[i] != i)
+      return false;
+  return true;
+}
+
+int main()
+{
+  if (sizeof t_00 != sizeof(int) || !is_iota(t_00, 1)
+   || sizeof t_09 != 10 * sizeof(int) || !is_iota(t_09, 10)
+   || sizeof t_12 != 0x13 * sizeof(int) || !is_iota(t_12, 0x13))
+    return 1;
+  if (sizeof rows / sizeof *rows != 0x13)
+    return 2;
+  for (int h = 0; h != 0x13; ++h)
+    if (rows[h][0] != h + 1 || !is_iota(rows[h] + 1, h + 1)
+     || (h + 2 != 0x14 && rows[h][h + 2] != 0))
+      return 3;
+  if (sizeof one / sizeof *one != 1 || one[0][0] != 1 || one[0][1] != 0)
+    return 4;
+  if (std::strcmp(digits, "0|01|012|0123") != 0)
+    return 5;
+}
+
+#include "IREPEAT_UNDEF.hpp"
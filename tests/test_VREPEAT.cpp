@@ -58,6 +58,43 @@ constexpr int vreps0xff[] {
 };
 CHECK(is_iota<0xff>(vreps0xff));
 
+// 5 and 6 digit counts; leading zeros keep the checks cheap
+#define VREPEAT_COUNT (0)(0)(0)(2)(1)
+#define VREPEAT_MACRO HEXLIT
+#define VREPEAT_SEPARATOR COMMA
+constexpr int vreps5x0x22[] {
+#include "VREPEAT.hpp"
+};
+CHECK(is_iota<0x22>(vreps5x0x22));
+
+#define VREPEAT_COUNT (0)(0)(0)(0)(1)(1)
+#define VREPEAT_MACRO HEXLIT
+#define VREPEAT_SEPARATOR COMMA
+constexpr int vreps6x0x12[] {
+#include "VREPEAT.hpp"
+};
+CHECK(is_iota<0x12>(vreps6x0x12));
+
+// Nonzero fifth digit, through the C4/D4 carry, counted by sizeof
+#define VCHAR(N) 'v',
+#define VREPEAT_COUNT (1)(0)(0)(0)(1)
+#define VREPEAT_MACRO VCHAR
+#define VREPEAT_SEPARATOR NOSEP
+constexpr char vchars5x10002[] {
+#include "VREPEAT.hpp"
+};
+CHECK(sizeof vchars5x10002 == 0x10002);
+
+#define VREPEAT_COUNT (0)(1)(0)(0)(0)(1)
+#define VREPEAT_MACRO VCHAR
+#define VREPEAT_SEPARATOR NOSEP
+constexpr char vchars6x10002[] {
+#include "VREPEAT.hpp"
+};
+CHECK(sizeof vchars6x10002 == 0x10002);
+
+#undef VCHAR
+
 }
 
 TEST_CASE("Nested REPEAT") {